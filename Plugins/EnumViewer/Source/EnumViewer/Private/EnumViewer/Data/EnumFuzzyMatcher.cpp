@@ -0,0 +1,145 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumFuzzyMatcher.h"
+
+namespace EnumViewer
+{
+	namespace EnumFuzzyMatcherInternal
+	{
+		// The score of each matched character.
+		static constexpr int32 MatchScore = 16;
+
+		// The bonus for a match at the start of the name or of a word.
+		static constexpr int32 BoundaryBonus = 10;
+
+		// The bonus for a match at a CamelCase hump or at the start of a number.
+		static constexpr int32 CamelCaseBonus = 8;
+
+		// The bonus for a match right after the previous one.
+		static constexpr int32 ConsecutiveBonus = 6;
+
+		// The penalty for each character skipped between or before the matches.
+		static constexpr int32 GapPenalty = 1;
+
+		// Returns whether the name follows the convention of prefixing enum names with "E", such as "EMovementMode".
+		static bool HasEnumPrefix(const FString& InEnumName)
+		{
+			return (InEnumName.Len() >= 2 && InEnumName[0] == TEXT('E') && FChar::IsUpper(InEnumName[1]));
+		}
+
+		// Returns the bonus for a match at the specified position of the name.
+		static int32 GetPositionBonus(const FString& InEnumName, const int32 InIndex, const bool bHasEnumPrefix)
+		{
+			if (InIndex == 0 || (InIndex == 1 && bHasEnumPrefix))
+			{
+				return BoundaryBonus;
+			}
+
+			const TCHAR Prev = InEnumName[InIndex - 1];
+			const TCHAR Char = InEnumName[InIndex];
+			if (!FChar::IsAlnum(Prev))
+			{
+				return BoundaryBonus;
+			}
+			if ((FChar::IsLower(Prev) && FChar::IsUpper(Char)) || (!FChar::IsDigit(Prev) && FChar::IsDigit(Char)))
+			{
+				return CamelCaseBonus;
+			}
+
+			return 0;
+		}
+	}
+
+	FEnumFuzzyMatcher::FEnumFuzzyMatcher(const FString& InTerm)
+		: Term(InTerm.ToLower())
+	{
+	}
+
+	bool FEnumFuzzyMatcher::Matches(const FString& InEnumName) const
+	{
+		int32 TermIndex = 0;
+		for (int32 Index = 0; Index < InEnumName.Len() && TermIndex < Term.Len(); Index++)
+		{
+			if (FChar::ToLower(InEnumName[Index]) == Term[TermIndex])
+			{
+				TermIndex++;
+			}
+		}
+
+		return (TermIndex == Term.Len());
+	}
+
+	int32 FEnumFuzzyMatcher::Score(const FString& InEnumName) const
+	{
+		using namespace EnumFuzzyMatcherInternal;
+
+		const int32 NameLen = InEnumName.Len();
+		const int32 TermLen = Term.Len();
+		if (TermLen == 0 || TermLen > NameLen)
+		{
+			return NoMatch;
+		}
+
+		const bool bHasEnumPrefix = HasEnumPrefix(InEnumName);
+		TArray<int32, TInlineAllocator<128>> Bonuses;
+		Bonuses.SetNumUninitialized(NameLen);
+		for (int32 Index = 0; Index < NameLen; Index++)
+		{
+			Bonuses[Index] = GetPositionBonus(InEnumName, Index, bHasEnumPrefix);
+		}
+
+		// Each row holds the best score of the alignments of the first characters of the term that end at each position of the name.
+		// Skipping the "E" prefix is not penalized, so that searching without it is not at a disadvantage.
+		TArray<int32, TInlineAllocator<128>> PrevRow;
+		TArray<int32, TInlineAllocator<128>> CurrentRow;
+		PrevRow.Init(NoMatch, NameLen);
+		CurrentRow.Init(NoMatch, NameLen);
+
+		const int32 LeadingCharsToIgnore = (bHasEnumPrefix ? 1 : 0);
+		for (int32 Index = 0; Index < NameLen; Index++)
+		{
+			if (FChar::ToLower(InEnumName[Index]) == Term[0])
+			{
+				PrevRow[Index] = MatchScore + Bonuses[Index] - GapPenalty * FMath::Max(0, Index - LeadingCharsToIgnore);
+			}
+		}
+
+		for (int32 TermIndex = 1; TermIndex < TermLen; TermIndex++)
+		{
+			// The best score of the previous row so far, less the penalty for the characters skipped since then.
+			int32 BestPrevScore = NoMatch;
+			CurrentRow[0] = NoMatch;
+			for (int32 Index = 1; Index < NameLen; Index++)
+			{
+				BestPrevScore = FMath::Max(BestPrevScore - GapPenalty, PrevRow[Index - 1]);
+
+				int32& CellScore = CurrentRow[Index];
+				CellScore = NoMatch;
+				if (FChar::ToLower(InEnumName[Index]) != Term[TermIndex])
+				{
+					continue;
+				}
+
+				int32 BestScore = BestPrevScore;
+				if (PrevRow[Index - 1] > NoMatch)
+				{
+					BestScore = FMath::Max(BestScore, PrevRow[Index - 1] + ConsecutiveBonus);
+				}
+				if (BestScore > NoMatch)
+				{
+					CellScore = BestScore + MatchScore + Bonuses[Index];
+				}
+			}
+
+			Swap(PrevRow, CurrentRow);
+		}
+
+		int32 BestScore = NoMatch;
+		for (const int32 CellScore : PrevRow)
+		{
+			BestScore = FMath::Max(BestScore, CellScore);
+		}
+
+		return BestScore;
+	}
+}
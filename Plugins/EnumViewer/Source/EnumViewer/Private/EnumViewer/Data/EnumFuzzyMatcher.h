@@ -0,0 +1,35 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EnumViewer
+{
+	/**
+	 * Matches enum names that contain the characters of a search term in order, ignoring case,
+	 * and scores how well they match so that the results can be ranked.
+	 * Matches at the start of words, at CamelCase humps and right after the "E" prefix of enum names score higher,
+	 * as do runs of consecutive characters.
+	 */
+	class FEnumFuzzyMatcher
+	{
+	public:
+		// The score returned for names that don't match.
+		static constexpr int32 NoMatch = MIN_int32 / 2;
+
+	public:
+		// Constructor.
+		explicit FEnumFuzzyMatcher(const FString& InTerm);
+
+		// Returns whether the name contains all characters of the term in order.
+		bool Matches(const FString& InEnumName) const;
+
+		// Returns the score of the best alignment of the term in the name, or NoMatch if it doesn't match.
+		int32 Score(const FString& InEnumName) const;
+
+	private:
+		// The lower case characters of the term.
+		FString Term;
+	};
+}
@@ -0,0 +1,102 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumPathClassifier.h"
+#include "EnumViewer/Utilities/EnumViewerProjectSettings.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+namespace EnumViewer
+{
+	namespace EnumPathClassifierInternal
+	{
+		// Compares the paths in the same case-insensitive manner as FString::StartsWith.
+		static bool IsLessIgnoreCase(const FString& Lhs, const FString& Rhs)
+		{
+			return (Lhs.Compare(Rhs, ESearchCase::IgnoreCase) < 0);
+		}
+	}
+
+	void FEnumPathClassifier::Compile()
+	{
+		const UEnumViewerProjectSettings& Settings = UEnumViewerProjectSettings::Get();
+
+		TArray<FString> SortedPaths;
+		SortedPaths.Reserve(Settings.InternalOnlyPaths.Num());
+		for (const FDirectoryPath& InternalPath : Settings.InternalOnlyPaths)
+		{
+			if (!InternalPath.Path.IsEmpty())
+			{
+				SortedPaths.Add(InternalPath.Path);
+			}
+		}
+		SortedPaths.Sort(&EnumPathClassifierInternal::IsLessIgnoreCase);
+
+		// In sorted order, the paths that start with a given path immediately follow it,
+		// so comparing with the last kept path is enough to drop all the covered ones.
+		InternalPathPrefixes.Reset(SortedPaths.Num());
+		for (FString& SortedPath : SortedPaths)
+		{
+			if (InternalPathPrefixes.Num() == 0 || !SortedPath.StartsWith(InternalPathPrefixes.Last()))
+			{
+				InternalPathPrefixes.Add(MoveTemp(SortedPath));
+			}
+		}
+
+		InternalEnumPaths.Reset();
+		for (const TSoftObjectPtr<const UEnum>& InternalEnum : Settings.InternalOnlyEnums)
+		{
+			if (!InternalEnum.IsNull())
+			{
+				InternalEnumPaths.Add(*InternalEnum.ToString());
+			}
+		}
+
+		DeveloperPathWithSlash = FPackageName::FilenameToLongPackageName(FPaths::GameDevelopersDir());
+		UserDeveloperPathWithSlash = FPackageName::FilenameToLongPackageName(FPaths::GameUserDeveloperDir());
+
+		Serial++;
+	}
+
+	EEnumPathFlags FEnumPathClassifier::Classify(const FName& InEnumPath, FString& Buffer) const
+	{
+		EEnumPathFlags Flags = EEnumPathFlags::Classified;
+		if (InternalEnumPaths.Contains(InEnumPath))
+		{
+			Flags |= EEnumPathFlags::InternalOnly;
+		}
+
+		InEnumPath.ToString(Buffer);
+		if (!EnumHasAnyFlags(Flags, EEnumPathFlags::InternalOnly) && IsUnderInternalPath(Buffer))
+		{
+			Flags |= EEnumPathFlags::InternalOnly;
+		}
+
+		if (Buffer.StartsWith(DeveloperPathWithSlash))
+		{
+			Flags |= EEnumPathFlags::Developer;
+			if (Buffer.StartsWith(UserDeveloperPathWithSlash))
+			{
+				Flags |= EEnumPathFlags::CurrentUserDeveloper;
+			}
+		}
+
+		return Flags;
+	}
+
+	uint32 FEnumPathClassifier::GetSerial() const
+	{
+		return Serial;
+	}
+
+	bool FEnumPathClassifier::IsUnderInternalPath(const FString& InEnumPath) const
+	{
+		const int32 UpperBound = Algo::UpperBound(InternalPathPrefixes, InEnumPath, &EnumPathClassifierInternal::IsLessIgnoreCase);
+		if (UpperBound == 0)
+		{
+			return false;
+		}
+
+		return InEnumPath.StartsWith(InternalPathPrefixes[UpperBound - 1]);
+	}
+}
@@ -0,0 +1,65 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EnumViewer
+{
+	/**
+	 * The classifications of an enum path used by the visibility filters of the enum viewer.
+	 */
+	enum class EEnumPathFlags : uint8
+	{
+		// The path has not been classified yet.
+		None = 0,
+		// The path has been classified. The other flags are only meaningful when this is set.
+		Classified = 1 << 0,
+		// The path is under one of the internal only paths, or is one of the internal only enums.
+		InternalOnly = 1 << 1,
+		// The path is under the developers folder.
+		Developer = 1 << 2,
+		// The path is under the current user's developer folder.
+		CurrentUserDeveloper = 1 << 3,
+	};
+	ENUM_CLASS_FLAGS(EEnumPathFlags);
+
+	/**
+	 * A lookup structure compiled from the project settings that classifies enum paths with a few comparisons,
+	 * regardless of the number of internal only paths and enums.
+	 */
+	class FEnumPathClassifier
+	{
+	public:
+		// Compiles the internal only paths and enums in the project settings and the developer folders.
+		void Compile();
+
+		// Returns the classifications of the specified enum path.
+		// The buffer is used to convert the path to a string and can be reused between calls.
+		EEnumPathFlags Classify(const FName& InEnumPath, FString& Buffer) const;
+
+		// Returns a number that changes every time the classifier is compiled.
+		uint32 GetSerial() const;
+
+	private:
+		// Returns whether the path starts with one of the internal only paths.
+		bool IsUnderInternalPath(const FString& InEnumPath) const;
+
+	private:
+		// The internal only paths sorted in case-insensitive order, without any path that starts with another one.
+		// This ensures that the only candidate prefix of a path is the last one that is not greater than that path.
+		TArray<FString> InternalPathPrefixes;
+
+		// The paths of the internal only enums, which must match exactly.
+		TSet<FName> InternalEnumPaths;
+
+		// The long package path of the developers folder, ending with a slash.
+		FString DeveloperPathWithSlash;
+
+		// The long package path of the current user's developer folder, ending with a slash.
+		FString UserDeveloperPathWithSlash;
+
+		// The number of times the classifier has been compiled.
+		uint32 Serial = 0;
+	};
+}
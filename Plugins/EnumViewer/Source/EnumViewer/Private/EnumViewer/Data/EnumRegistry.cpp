@@ -1,32 +1,79 @@
 // Copyright 2022 Naotsun. All Rights Reserved.
 
 #include "EnumViewer/Data/EnumRegistry.h"
+#include "EnumViewer/EnumViewerGlobals.h"
+#include "EnumViewer/Utilities/EnumViewerProjectSettings.h"
 #include "AssetRegistryModule.h"
 #include "Misc/HotReloadInterface.h"
-#include "Misc/ScopedSlowTask.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
 #include "Engine/UserDefinedEnum.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectGlobals.h"
+#include "Misc/PackageName.h"
+#include "HAL/IConsoleManager.h"
+#include "Internationalization/Internationalization.h"
 
 #define LOCTEXT_NAMESPACE "EnumRegistry"
 
 namespace EnumViewer
 {
 	DECLARE_STATS_GROUP(TEXT("EnumRegistry"), STATGROUP_EnumRegistry, STATCAT_Advanced);
+
+	namespace EnumRegistryInternal
+	{
+		// The number of nodes below which filtering in parallel doesn't pay off.
+		static constexpr int32 MinNodesToFilterInParallel = 4096;
+
+		// The number of nodes tested by each task when filtering in parallel.
+		static constexpr int32 NodesPerFilterChunk = 1024;
+	}
+
+	static FAutoConsoleCommand DumpEnumRegistryStatsCommand(
+		TEXT("EnumViewer.DumpRegistryStats"),
+		TEXT("Prints the number of enums in the Enum Registry and its memory footprint."),
+		FConsoleCommandDelegate::CreateLambda(
+			[]()
+			{
+				if (const FEnumRegistry* EnumRegistry = FEnumRegistry::GetPtr())
+				{
+					EnumRegistry->DumpStats();
+				}
+			}
+		)
+	);
 	
 	FEnumRegistry::FEnumRegistry()
 	{
 		// Bind to the event when the Enum Registry is updated.
-		FAssetRegistryModule::GetRegistry().OnFilesLoaded().AddRaw(this, &FEnumRegistry::DirtyEnumRegistry);
+		IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+		AssetRegistry.OnFilesLoaded().AddRaw(this, &FEnumRegistry::DirtyEnumRegistry);
+		AssetRegistry.OnAssetAdded().AddRaw(this, &FEnumRegistry::OnAssetAdded);
+		AssetRegistry.OnAssetRemoved().AddRaw(this, &FEnumRegistry::OnAssetRemoved);
+		AssetRegistry.OnAssetRenamed().AddRaw(this, &FEnumRegistry::OnAssetRenamed);
+		AssetRegistry.OnInMemoryAssetCreated().AddRaw(this, &FEnumRegistry::OnInMemoryAssetCreated);
 		FModuleManager::Get().OnModulesChanged().AddRaw(this, &FEnumRegistry::OnModulesChanged);
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FEnumRegistry::OnPostGarbageCollect);
+		UEnumViewerProjectSettings::OnSettingChanged().AddRaw(this, &FEnumRegistry::OnProjectSettingChanged);
+		FInternationalization::Get().OnCultureChanged().AddRaw(this, &FEnumRegistry::OnCultureChanged);
 		if (auto* HotReload = IHotReloadInterface::GetPtr())
 		{
 			HotReload->OnHotReload().AddRaw(this, &FEnumRegistry::OnHotReload);
 		}
 
+		Snapshot = MakeShared<FEnumRegistrySnapshot, ESPMode::ThreadSafe>();
 		PopulateEnumRegistry();
 	}
 
 	FEnumRegistry::~FEnumRegistry()
 	{
+		// The background task must not outlive the module.
+		if (PopulateTask.IsValid())
+		{
+			PopulateTask.Wait();
+		}
+		
 		if (FModuleManager::Get().IsModuleLoaded(TEXT("HotReload")))
 		{
 			if (auto* HotReload = IHotReloadInterface::GetPtr())
@@ -37,18 +84,29 @@ namespace EnumViewer
 		
 		if (FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
 		{
-			FAssetRegistryModule::GetRegistry().OnFilesLoaded().RemoveAll(this);
+			IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+			AssetRegistry.OnFilesLoaded().RemoveAll(this);
+			AssetRegistry.OnAssetAdded().RemoveAll(this);
+			AssetRegistry.OnAssetRemoved().RemoveAll(this);
+			AssetRegistry.OnAssetRenamed().RemoveAll(this);
+			AssetRegistry.OnInMemoryAssetCreated().RemoveAll(this);
 		}
 
 		FModuleManager::Get().OnModulesChanged().RemoveAll(this);
+		FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+		UEnumViewerProjectSettings::OnSettingChanged().RemoveAll(this);
+		if (FInternationalization::IsAvailable())
+		{
+			FInternationalization::Get().OnCultureChanged().RemoveAll(this);
+		}
 	}
 	
 	FEnumRegistry& FEnumRegistry::Get()
 	{
 		if (!Instance.IsValid())
 		{
+			// The constructor starts the first build, so don't start another one here.
 			Instance = MakeUnique<FEnumRegistry>();
-			Instance->PopulateEnumRegistry();
 		}
 		
 		return *Instance;
@@ -69,62 +127,320 @@ namespace EnumViewer
 		return OnPopulateEnumViewer;
 	}
 
-	TArray<TSharedPtr<FEnumViewerNode>> FEnumRegistry::GetNodeList(
-		const TSharedPtr<IPropertyHandle>& InPropertyHandle,
-		TFunction<bool(const TSharedPtr<FEnumViewerNode>& EnumViewerNode)> FilterPredicate
-	) const
+	FEnumRegistry::FOnEnumRegistryChanged& FEnumRegistry::GetOnEnumRegistryChanged()
+	{
+		return OnEnumRegistryChanged;
+	}
+
+	FEnumRegistry::FOnPopulatingChanged& FEnumRegistry::GetOnPopulatingChanged()
+	{
+		return OnPopulatingChanged;
+	}
+
+	const FEnumRegistrySnapshot& FEnumRegistry::GetSnapshot() const
+	{
+		return *Snapshot;
+	}
+
+	const FEnumRegistrySnapshotPtr& FEnumRegistry::GetSnapshotPtr() const
 	{
-		TArray<TSharedPtr<FEnumViewerNode>> FilteredEnumNodes;
-		for (const auto& EnumNode : EnumNodes)
+		return Snapshot;
+	}
+
+	void FEnumRegistry::FilterNodeIndices(
+		TFunctionRef<void(TArrayView<const int32> CandidateIndices, TArray<int32>& OutPassedIndices)> BatchFilter,
+		TArrayView<const int32> InCandidateIndices,
+		TArray<int32>& OutNodeIndices,
+		const bool bIsFilterThreadSafe
+	)
+	{
+		const int32 NumToTest = InCandidateIndices.Num();
+		OutNodeIndices.Reserve(OutNodeIndices.Num() + NumToTest);
+		if (bIsFilterThreadSafe &&
+			NumToTest >= EnumRegistryInternal::MinNodesToFilterInParallel &&
+			FApp::ShouldUseThreadingForPerformance())
 		{
-			if (!EnumNode.IsValid())
+			// Each chunk collects its own result, and the results are joined in the order of the chunks,
+			// so the order doesn't depend on how the chunks were scheduled.
+			const int32 NumChunks = FMath::DivideAndRoundUp(NumToTest, EnumRegistryInternal::NodesPerFilterChunk);
+			TArray<TArray<int32>> ChunkNodeIndices;
+			ChunkNodeIndices.SetNum(NumChunks);
+			ParallelFor(
+				NumChunks,
+				[&](const int32 ChunkIndex)
+				{
+					const int32 Start = ChunkIndex * EnumRegistryInternal::NodesPerFilterChunk;
+					const int32 End = FMath::Min(Start + EnumRegistryInternal::NodesPerFilterChunk, NumToTest);
+					TArray<int32>& NodeIndices = ChunkNodeIndices[ChunkIndex];
+					NodeIndices.Reserve(End - Start);
+					BatchFilter(InCandidateIndices.Slice(Start, End - Start), NodeIndices);
+				}
+			);
+
+			for (const TArray<int32>& NodeIndices : ChunkNodeIndices)
 			{
-				continue;
+				OutNodeIndices.Append(NodeIndices);
 			}
-			
-			FilteredEnumNodes.Add(
-				MakeShared<FEnumViewerNode>(
-					EnumNode,
-					InPropertyHandle,
-					FilterPredicate(EnumNode)
-				)
-			);
 		}
-			
-		return FilteredEnumNodes;
+		else
+		{
+			BatchFilter(InCandidateIndices, OutNodeIndices);
+		}
 	}
 
-	TSharedPtr<FEnumViewerNode> FEnumRegistry::FindNodeByEnumPath(const FName& InEnumPath)
+	const TArray<int32>& FEnumRegistry::GetSortedNodeIndices(const EEnumViewerSortType InSortType, const EEnumViewerNameTypeToDisplay InNameType) const
 	{
-		const TSharedPtr<FEnumViewerNode>* FoundEnumPtr = EnumNodes.FindByPredicate(
-				[&InEnumPath](const TSharedPtr<FEnumViewerNode>& EnumNodePtr)
-				{
-					if (EnumNodePtr.IsValid())
+		if (InSortType == EEnumViewerSortType::Name || !ensure(InSortType < EEnumViewerSortType::Max))
+		{
+			return Snapshot->GetSortedNodeIndices();
+		}
+
+		FSortedNodeIndices& SortedNodeIndices = (
+			InSortType == EEnumViewerSortType::DisplayName ?
+			SortedNodeIndicesByNameType.FindOrAdd(static_cast<uint8>(InNameType)) :
+			SortedNodeIndicesBySortType[static_cast<int32>(InSortType)]
+		);
+		if (SortedNodeIndices.Generation != Snapshot->GetGeneration())
+		{
+			SortNodeIndices(InSortType, InNameType, SortedNodeIndices.NodeIndices);
+			SortedNodeIndices.Generation = Snapshot->GetGeneration();
+		}
+
+		return SortedNodeIndices.NodeIndices;
+	}
+
+	void FEnumRegistry::NotifyEnumPicked(const FName& InEnumPath)
+	{
+		LastPickSerials.Add(InEnumPath, ++NumPicks);
+		SortedNodeIndicesBySortType[static_cast<int32>(EEnumViewerSortType::LastPicked)].Generation = 0;
+	}
+
+	void FEnumRegistry::InvalidateDisplayNameOrders()
+	{
+		for (auto& Pair : SortedNodeIndicesByNameType)
+		{
+			Pair.Value.Generation = 0;
+		}
+	}
+
+	void FEnumRegistry::SortNodeIndices(const EEnumViewerSortType InSortType, const EEnumViewerNameTypeToDisplay InNameType, TArray<int32>& OutNodeIndices) const
+	{
+		// Start from the alphabetical order, which the stable sort by keys keeps for the nodes with the same key.
+		const FEnumRegistrySnapshot& CurrentSnapshot = *Snapshot;
+		const int32 NumNodes = CurrentSnapshot.Num();
+		OutNodeIndices = CurrentSnapshot.GetSortedNodeIndices();
+
+		// The keys of string columns only hold a prefix, so the strings are kept to order the nodes that share it.
+		TArray<uint64> SortKeys;
+		SortKeys.SetNumUninitialized(NumNodes);
+		TArray<FString> SortStrings;
+		switch (InSortType)
+		{
+		case EEnumViewerSortType::DisplayName:
+		{
+			// Sort by the same text the rows display, such as the enum name followed by the display name.
+			SortStrings.SetNum(NumNodes);
+			for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+			{
+				SortStrings[NodeIndex] = CurrentSnapshot.GetNode(NodeIndex)->GetEnumDisplayName(InNameType).ToString();
+				SortKeys[NodeIndex] = FEnumSortOrder::MakeSortKey(SortStrings[NodeIndex]);
+			}
+			break;
+		}
+		case EEnumViewerSortType::Module:
+		{
+			SortStrings.SetNum(NumNodes);
+			const TArray<FName>& ModuleNames = CurrentSnapshot.GetModuleNames();
+			for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+			{
+				ModuleNames[NodeIndex].ToString(SortStrings[NodeIndex]);
+				SortKeys[NodeIndex] = FEnumSortOrder::MakeSortKey(SortStrings[NodeIndex]);
+			}
+			break;
+		}
+		case EEnumViewerSortType::NumValues:
+		{
+			// The enums whose number of values is unknown come last.
+			const TArray<int32>& NumValues = CurrentSnapshot.GetNumValues();
+			for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+			{
+				SortKeys[NodeIndex] = (NumValues[NodeIndex] != INDEX_NONE ? static_cast<uint64>(NumValues[NodeIndex]) : MAX_uint64);
+			}
+			break;
+		}
+		case EEnumViewerSortType::LastPicked:
+		{
+			// The later an enum was picked, the smaller its key, and the enums never picked come last.
+			const TArray<FName>& EnumPaths = CurrentSnapshot.GetEnumPaths();
+			for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+			{
+				const uint64* LastPickSerial = LastPickSerials.Find(EnumPaths[NodeIndex]);
+				SortKeys[NodeIndex] = (LastPickSerial != nullptr ? MAX_uint64 - *LastPickSerial : MAX_uint64);
+			}
+			break;
+		}
+		default:
+			checkNoEntry();
+			break;
+		}
+
+		FEnumSortOrder::SortByKeys(OutNodeIndices, SortKeys);
+		if (SortStrings.Num() == 0)
+		{
+			return;
+		}
+
+		// Order each run of nodes with the same key by their strings.
+		int32 RunStart = 0;
+		while (RunStart < NumNodes)
+		{
+			// Most runs of a module consist of the same string, which are already in order.
+			const FString& RunString = SortStrings[OutNodeIndices[RunStart]];
+			bool bIsRunOfSameString = true;
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < NumNodes && SortKeys[OutNodeIndices[RunEnd]] == SortKeys[OutNodeIndices[RunStart]])
+			{
+				bIsRunOfSameString &= SortStrings[OutNodeIndices[RunEnd]].Equals(RunString, ESearchCase::IgnoreCase);
+				RunEnd++;
+			}
+
+			if (!bIsRunOfSameString)
+			{
+				MakeArrayView(OutNodeIndices.GetData() + RunStart, RunEnd - RunStart).StableSort(
+					[&SortStrings](const int32 Lhs, const int32 Rhs) -> bool
 					{
-						return (EnumNodePtr->GetEnumPath() == InEnumPath);
+						return (FCString::Stricmp(*SortStrings[Lhs], *SortStrings[Rhs]) < 0);
 					}
+				);
+			}
+			RunStart = RunEnd;
+		}
+	}
 
-					return false;
-				}
-			);
+	void FEnumRegistry::ClassifyPaths()
+	{
+		if (bPathClassifierDirty)
+		{
+			PathClassifier.Compile();
+			bPathClassifierDirty = false;
+		}
+
+		Snapshot->ClassifyPaths(PathClassifier);
+	}
 
-		if (FoundEnumPtr != nullptr)
+	TSharedPtr<FEnumViewerNode> FEnumRegistry::FindNodeByEnumPath(const FName& InEnumPath)
+	{
+		return Snapshot->FindNode(InEnumPath);
+	}
+
+	void FEnumRegistry::OnNodeEnumChanged(const FEnumViewerNode& InNode)
+	{
+		check(IsInGameThread());
+
+		// Ignore the nodes of a snapshot that has been replaced.
+		const int32 NodeIndex = InNode.GetRegistryIndex();
+		if (!Snapshot->GetNodes().IsValidIndex(NodeIndex) || Snapshot->GetNode(NodeIndex).Get() != &InNode)
 		{
-			return *FoundEnumPtr;
+			return;
 		}
 
-		return nullptr;
+		if (Snapshot->RefreshNode(InNode))
+		{
+			SortedNodeIndicesBySortType[static_cast<int32>(EEnumViewerSortType::NumValues)].Generation = 0;
+		}
+
+		// The display name of the node is resolved again from the enum, or synthesized again without it.
+		InvalidateDisplayNameOrders();
+	}
+
+	SIZE_T FEnumRegistry::GetAllocatedSize() const
+	{
+		return Snapshot->GetAllocatedSize();
+	}
+
+	void FEnumRegistry::DumpStats() const
+	{
+		const FEnumTrigramIndex* TrigramIndex = Snapshot->GetTrigramIndex();
+		UE_LOG(
+			LogEnumViewer, Log,
+			TEXT("Enum Registry : %d enums, %.2f KiB (search index : %s)"),
+			Snapshot->Num(),
+			static_cast<float>(GetAllocatedSize()) / 1024.0f,
+			TrigramIndex != nullptr ? *FString::Printf(TEXT("%.2f KiB"), static_cast<float>(TrigramIndex->GetAllocatedSize()) / 1024.0f) : TEXT("disabled")
+		);
+	}
+
+	bool FEnumRegistry::IsPopulating() const
+	{
+		return (PopulateTask.IsValid() || TimeSlicedRebuild.IsValid());
+	}
+
+	void FEnumRegistry::RegisterViewer()
+	{
+		NumViewers++;
+	}
+
+	void FEnumRegistry::UnregisterViewer()
+	{
+		check(NumViewers > 0);
+		NumViewers--;
 	}
 
 	void FEnumRegistry::Tick(float DeltaTime)
 	{
-		bRefreshEnumHierarchy = false;
-		PopulateEnumRegistry();
+		if (PopulateTask.IsValid() && PopulateTask.IsReady())
+		{
+			FinishPopulateEnumRegistry();
+		}
+
+		// A time-sliced rebuild that has started runs to the end even if all the viewers are closed,
+		// as the pending changes and the purge of dead nodes wait for it to finish.
+		// Only starting a new rebuild is deferred until a viewer is open.
+		if (TimeSlicedRebuild.IsValid())
+		{
+			TickTimeSlicedRebuild();
+		}
+		
+		if (ShouldPopulateEnumRegistry())
+		{
+			PopulateEnumRegistry();
+		}
+
+		// Apply the changes made since the last frame as a single batch.
+		// While a new snapshot is being built, the changes are kept so that they can be applied on top of it.
+		if (!IsPopulating())
+		{
+			ProcessPendingChanges();
+
+			if (bPurgeDeadNodes)
+			{
+				PurgeDeadNodes();
+			}
+		}
+
+		// Notify the changes made since the last frame at once.
+		if (!PendingDelta.IsEmpty())
+		{
+			// The index itself follows the added and removed nodes, but the registry may have crossed the size threshold.
+			UpdateTrigramIndex();
+
+			const FEnumRegistryDelta Delta = MoveTemp(PendingDelta);
+			PendingDelta.Reset();
+			OnEnumRegistryChanged.Broadcast(Delta);
+		}
 	}
 
 	bool FEnumRegistry::IsTickable() const
 	{
-		return bRefreshEnumHierarchy;
+		return (
+			bRefreshEnumHierarchy ||
+			bPurgeDeadNodes ||
+			IsPopulating() ||
+			!PendingDelta.IsEmpty() ||
+			PendingModulePackages.Num() > 0 ||
+			PendingAddedEnumAssets.Num() > 0 ||
+			PendingRemovedEnumAssets.Num() > 0
+		);
 	}
 
 	TStatId FEnumRegistry::GetStatId() const
@@ -142,47 +458,68 @@ namespace EnumViewer
 		return true;
 	}
 
+	void FEnumRegistry::PreChange(const UUserDefinedEnum* Changed, FEnumEditorUtils::EEnumEditorChangeInfo ChangedType)
+	{
+	}
+
+	void FEnumRegistry::PostChange(const UUserDefinedEnum* Changed, FEnumEditorUtils::EEnumEditorChangeInfo ChangedType)
+	{
+		// Values and flags may have been edited in the enum editor.
+		if (!IsValid(Changed))
+		{
+			return;
+		}
+
+		const TSharedPtr<FEnumViewerNode> Node = Snapshot->FindNode(*Changed->GetPathName());
+		if (Node.IsValid() && Node->GetEnum() == Changed)
+		{
+			OnNodeEnumChanged(*Node);
+		}
+	}
+
 	void FEnumRegistry::DirtyEnumRegistry()
 	{
 		bRefreshEnumHierarchy = true;
+		LastDirtyTime = FPlatformTime::Seconds();
 	}
 
-	void FEnumRegistry::PopulateEnumRegistry()
+	bool FEnumRegistry::ShouldPopulateEnumRegistry() const
 	{
-		FScopedSlowTask SlowTask(0.0f, LOCTEXT("RebuildingEnumRegistry", "Rebuilding Enum Registry"));
-		SlowTask.MakeDialog();
-
-		auto AddUnique = [this](const TSharedPtr<FEnumViewerNode>& NewEnumViewerNodeData)
+		// Nothing needs the result while no viewer is open, so keep it dirty until one is.
+		if (!bRefreshEnumHierarchy || IsPopulating() || NumViewers == 0)
 		{
-			const auto* FoundEnumNode = EnumNodes.FindByPredicate(
-				[&NewEnumViewerNodeData](const TSharedPtr<FEnumViewerNode>& EnumViewerNodeData) -> bool
-				{
-					if (EnumViewerNodeData.IsValid() && NewEnumViewerNodeData.IsValid())
-					{
-						return (EnumViewerNodeData->GetEnumPath() == NewEnumViewerNodeData->GetEnumPath());
-					}
+			return false;
+		}
 
-					return false;
-				}
-			);
+		const double DebounceTime = UEnumViewerProjectSettings::Get().RegistryRebuildDebounceTime;
+		return ((FPlatformTime::Seconds() - LastDirtyTime) >= DebounceTime);
+	}
 
-			if (FoundEnumNode == nullptr)
-			{
-				EnumNodes.Add(NewEnumViewerNodeData);
-			}
-		};
+	void FEnumRegistry::PopulateEnumRegistry()
+	{
+		// Build again after the current one has been published, as it may already be outdated.
+		// Any number of requests made until then are coalesced into that single follow-up build.
+		if (IsPopulating())
+		{
+			bRefreshEnumHierarchy = true;
+			return;
+		}
+
+		bRefreshEnumHierarchy = false;
 		
-		// Go through all of the enums and see if they should be added to the list.
+		// Objects can only be iterated on the game thread, so collect them here.
+		TArray<TWeakObjectPtr<const UEnum>> Enums;
 		for (const auto* Enum : TObjectRange<UEnum>())
 		{
 			if (IsValid(Enum))
 			{
-				const TSharedPtr<FEnumViewerNode> EnumViewerNodeData = MakeShared<FEnumViewerNode>(Enum);
-				AddUnique(EnumViewerNodeData);
+				Enums.Add(Enum);
 			}
 		}
 
 		// Add any enum assets directly under the root (since they don't support inheritance)
+		// The asset registry is not thread safe, so query it here as well.
+		TArray<FAssetData> UserDefinedEnumsList;
 		{
 			const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
 
@@ -190,27 +527,465 @@ namespace EnumViewer
 			Filter.ClassNames.Add(UUserDefinedEnum::StaticClass()->GetFName());
 			Filter.bRecursiveClasses = true;
 
-			TArray<FAssetData> UserDefinedEnumsList;
 			AssetRegistryModule.Get().GetAssets(Filter, UserDefinedEnumsList);
-			
-			for (const FAssetData& UserDefinedEnumData : UserDefinedEnumsList)
+		}
+
+		// The changes queued so far are covered by the rebuild.
+		PendingModulePackages.Reset();
+		PendingAddedEnumAssets.Reset();
+		PendingRemovedEnumAssets.Reset();
+
+		if (UEnumViewerProjectSettings::Get().RegistryRebuildMode == EEnumRegistryRebuildMode::TimeSliced)
+		{
+			// Update the current snapshot in place so that the viewers can show the progress.
+			TimeSlicedRebuild = MakeUnique<FTimeSlicedRebuild>();
+			TimeSlicedRebuild->Enums = MoveTemp(Enums);
+			TimeSlicedRebuild->EnumAssets = MoveTemp(UserDefinedEnumsList);
+			TimeSlicedRebuild->VisitedEnumPaths.Reserve(TimeSlicedRebuild->Enums.Num() + TimeSlicedRebuild->EnumAssets.Num());
+			OnPopulatingChanged.Broadcast(true);
+			return;
+		}
+
+		// Objects must not be read on the worker thread, as they can be garbage collected or renamed at any time,
+		// so read the names here and leave the node construction and the sorting to the worker thread.
+		TArray<FLoadedEnum> LoadedEnums;
+		LoadedEnums.Reserve(Enums.Num());
+		for (const TWeakObjectPtr<const UEnum>& Enum : Enums)
+		{
+			FLoadedEnum& LoadedEnum = LoadedEnums.AddDefaulted_GetRef();
+			LoadedEnum.Enum = Enum;
+			LoadedEnum.EnumName = Enum->GetFName();
+			LoadedEnum.EnumPath = *Enum->GetPathName();
+			LoadedEnum.PackageName = Enum->GetOutermost()->GetFName();
+		}
+
+		// The settings can't be read on the worker thread either, so decide on the trigram index from the number of candidates.
+		const bool bBuildTrigramIndex = ShouldUseTrigramIndex(LoadedEnums.Num() + UserDefinedEnumsList.Num());
+
+		PopulateTask = Async(
+			EAsyncExecution::ThreadPool,
+			[LoadedEnums = MoveTemp(LoadedEnums), UserDefinedEnumsList = MoveTemp(UserDefinedEnumsList), bBuildTrigramIndex]() -> FEnumRegistrySnapshotPtr
+			{
+				return BuildSnapshot(LoadedEnums, UserDefinedEnumsList, bBuildTrigramIndex);
+			}
+		);
+		OnPopulatingChanged.Broadcast(true);
+	}
+
+	void FEnumRegistry::FinishPopulateEnumRegistry()
+	{
+		const FEnumRegistrySnapshotPtr NewSnapshot = PopulateTask.Get();
+		PopulateTask = TFuture<FEnumRegistrySnapshotPtr>();
+		if (!NewSnapshot.IsValid())
+		{
+			OnPopulatingChanged.Broadcast(false);
+			return;
+		}
+
+		// The columns read from the enums are left to the game thread, as the meta data isn't safe to read on the worker.
+		NewSnapshot->RefreshAllNodes();
+
+		// Publish the new snapshot at once. Viewers keep showing the previous one until here.
+		Snapshot = NewSnapshot;
+		UE_LOG(
+			LogEnumViewer, Verbose,
+			TEXT("Enum Registry rebuilt : %d enums, %.2f KiB"),
+			Snapshot->Num(),
+			static_cast<float>(GetAllocatedSize()) / 1024.0f
+		);
+
+		// Apply the changes queued while the snapshot was being built on top of it.
+		ProcessPendingChanges();
+		UpdateTrigramIndex();
+		
+		// All viewers must refresh, so the pending changes are no longer needed.
+		// The end of the build is only told once the new snapshot is in place, so that the viewers never refresh from the previous one.
+		PendingDelta.Reset();
+		OnPopulatingChanged.Broadcast(false);
+		OnPopulateEnumViewer.Broadcast();
+	}
+
+	void FEnumRegistry::TickTimeSlicedRebuild()
+	{
+		check(TimeSlicedRebuild.IsValid());
+		
+		const double FrameBudget = UEnumViewerProjectSettings::Get().RegistryRebuildFrameBudget / 1000.0;
+		const double EndTime = FPlatformTime::Seconds() + FrameBudget;
+
+		// Visit at least one item per frame so that the rebuild always makes progress.
+		do
+		{
+			FTimeSlicedRebuild& Rebuild = *TimeSlicedRebuild;
+			if (Rebuild.Enums.IsValidIndex(Rebuild.NextEnumIndex))
+			{
+				// The enum may have been garbage collected since the rebuild started.
+				const TWeakObjectPtr<const UEnum>& Enum = Rebuild.Enums[Rebuild.NextEnumIndex++];
+				if (!Enum.IsValid())
+				{
+					continue;
+				}
+
+				const FName EnumPath = *Enum->GetPathName();
+				Rebuild.VisitedEnumPaths.Add(EnumPath);
+				// A hot-reloaded enum is a new object at the same path, so the node of the old one is replaced.
+				const TSharedPtr<FEnumViewerNode> ExistingNode = Snapshot->FindNode(EnumPath);
+				if (!ExistingNode.IsValid())
+				{
+					const TSharedPtr<FEnumViewerNode> NewNode = MakeShared<FEnumViewerNode>(Enum.Get());
+					if (Snapshot->AddNode(NewNode))
+					{
+						Snapshot->RefreshNode(*NewNode);
+						PendingDelta.AddedEnumPaths.Add(EnumPath);
+					}
+				}
+				else if (ExistingNode->GetEnum() != Enum.Get())
+				{
+					const TSharedPtr<FEnumViewerNode> NewNode = MakeShared<FEnumViewerNode>(Enum.Get());
+					if (Snapshot->ReplaceNode(NewNode))
+					{
+						Snapshot->RefreshNode(*NewNode);
+						PendingDelta.RemovedEnumPaths.Add(EnumPath);
+						PendingDelta.AddedEnumPaths.Add(EnumPath);
+					}
+				}
+			}
+			else if (Rebuild.EnumAssets.IsValidIndex(Rebuild.NextEnumAssetIndex))
 			{
-				const TSharedPtr<FEnumViewerNode> EnumViewerNodeData = MakeShared<FEnumViewerNode>(UserDefinedEnumData);
-				AddUnique(EnumViewerNodeData);
+				// Enum assets that are already loaded have been visited as enums above.
+				const FAssetData& EnumAsset = Rebuild.EnumAssets[Rebuild.NextEnumAssetIndex++];
+				Rebuild.VisitedEnumPaths.Add(EnumAsset.ObjectPath);
+				if (!Snapshot->Contains(EnumAsset.ObjectPath))
+				{
+					const TSharedPtr<FEnumViewerNode> NewNode = MakeShared<FEnumViewerNode>(EnumAsset);
+					if (Snapshot->AddNode(NewNode))
+					{
+						Snapshot->RefreshNode(*NewNode);
+						PendingDelta.AddedEnumPaths.Add(EnumAsset.ObjectPath);
+					}
+				}
+			}
+			else
+			{
+				FinishTimeSlicedRebuild();
+				return;
 			}
 		}
+		while (FPlatformTime::Seconds() < EndTime);
+	}
+
+	void FEnumRegistry::FinishTimeSlicedRebuild()
+	{
+		check(TimeSlicedRebuild.IsValid());
 		
-		// All viewers must refresh.
+		TArray<FName> UnvisitedEnumPaths;
+		for (const FName& EnumPath : Snapshot->GetEnumPaths())
+		{
+			if (!TimeSlicedRebuild->VisitedEnumPaths.Contains(EnumPath))
+			{
+				UnvisitedEnumPaths.Add(EnumPath);
+			}
+		}
+		
+		for (const FName& EnumPath : UnvisitedEnumPaths)
+		{
+			if (Snapshot->RemoveNode(EnumPath))
+			{
+				PendingDelta.RemovedEnumPaths.Add(EnumPath);
+			}
+		}
+
+		TimeSlicedRebuild.Reset();
+		UE_LOG(
+			LogEnumViewer, Verbose,
+			TEXT("Enum Registry rebuilt : %d enums, %.2f KiB"),
+			Snapshot->Num(),
+			static_cast<float>(GetAllocatedSize()) / 1024.0f
+		);
+
+		// Apply the changes queued during the rebuild.
+		// The viewers have been following the rebuild through the deltas, so they don't need a full refresh.
+		ProcessPendingChanges();
+		OnPopulatingChanged.Broadcast(false);
+	}
+
+	FEnumRegistrySnapshotPtr FEnumRegistry::BuildSnapshot(
+		const TArray<FLoadedEnum>& InEnums,
+		const TArray<FAssetData>& InEnumAssets,
+		const bool bInBuildTrigramIndex
+	)
+	{
+		FEnumRegistrySnapshotPtr NewSnapshot = MakeShared<FEnumRegistrySnapshot, ESPMode::ThreadSafe>();
+		NewSnapshot->Reserve(InEnums.Num() + InEnumAssets.Num());
+
+		// Go through all of the enums and see if they should be added to the list.
+		// An enum that is garbage collected meanwhile leaves a stale node, which is purged once the snapshot has been published.
+		for (const FLoadedEnum& LoadedEnum : InEnums)
+		{
+			NewSnapshot->AddNode(MakeShared<FEnumViewerNode>(LoadedEnum.Enum, LoadedEnum.EnumName, LoadedEnum.EnumPath, LoadedEnum.PackageName));
+		}
+
+		// Enum assets that are already loaded have been added as enums above,
+		// so the rest are unloaded and don't need to be looked up, which couldn't be done on this thread anyway.
+		for (const FAssetData& EnumAsset : InEnumAssets)
+		{
+			if (NewSnapshot->Contains(EnumAsset.ObjectPath))
+			{
+				continue;
+			}
+
+			NewSnapshot->AddNode(MakeShared<FEnumViewerNode>(EnumAsset, false));
+		}
+
+		NewSnapshot->SetTrigramIndexEnabled(bInBuildTrigramIndex);
+
+		// Sort the nodes here as well, so that the first viewer to read the order doesn't have to.
+		NewSnapshot->GetSortedNodeIndices();
+
+		return NewSnapshot;
+	}
+
+	void FEnumRegistry::OnProjectSettingChanged()
+	{
+		// The classifications cached in the snapshot are discarded when the classifier is compiled again.
+		bPathClassifierDirty = true;
+		UpdateTrigramIndex();
 		OnPopulateEnumViewer.Broadcast();
 	}
 
+	bool FEnumRegistry::ShouldUseTrigramIndex(const int32 InNumNodes)
+	{
+		const UEnumViewerProjectSettings& Settings = UEnumViewerProjectSettings::Get();
+		return (Settings.bEnableSearchIndex && InNumNodes >= Settings.SearchIndexMinRegistrySize);
+	}
+
+	void FEnumRegistry::UpdateTrigramIndex()
+	{
+		Snapshot->SetTrigramIndexEnabled(ShouldUseTrigramIndex(Snapshot->Num()));
+	}
+
+	void FEnumRegistry::OnPostGarbageCollect()
+	{
+		// Defer to the next tick, as the garbage collector may run in the middle of other work.
+		bPurgeDeadNodes = true;
+	}
+
+	void FEnumRegistry::PurgeDeadNodes()
+	{
+		bPurgeDeadNodes = false;
+		
+		const IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+		FString PackageNameString;
+		
+		TArray<FName> RemovedEnumPaths;
+		TArray<const FEnumViewerNode*> NodesToReset;
+		Snapshot->RemoveNodes(
+			[&](const FEnumViewerNode& Node) -> bool
+			{
+				if (!Node.IsEnumStale())
+				{
+					return false;
+				}
+
+				// Enum assets can be loaded again, so keep them listed as long as they exist on disk.
+				Node.GetPackageName().ToString(PackageNameString);
+				if (!FPackageName::IsScriptPackage(PackageNameString) &&
+					AssetRegistry.GetAssetByObjectPath(Node.GetEnumPath(), true).IsValid())
+				{
+					NodesToReset.Add(&Node);
+					return false;
+				}
+
+				return true;
+			},
+			RemovedEnumPaths
+		);
+
+		// The nodes are reset once their registry indices have settled, as resetting updates the columns at those indices.
+		for (const FEnumViewerNode* Node : NodesToReset)
+		{
+			Node->ResetEnum();
+		}
+
+		PendingDelta.RemovedEnumPaths.Append(RemovedEnumPaths);
+	}
+
 	void FEnumRegistry::OnModulesChanged(FName ModuleThatChanged, EModuleChangeReason ReasonForChange)
 	{
-		if (ReasonForChange == EModuleChangeReason::ModuleLoaded ||
-			ReasonForChange == EModuleChangeReason::ModuleUnloaded)
+		// Only the enums in the script package of the changed module are affected.
+		const FName ScriptPackageName = *FPackageName::ConvertToLongScriptPackageName(*ModuleThatChanged.ToString());
+		if (ReasonForChange == EModuleChangeReason::ModuleLoaded)
+		{
+			PendingModulePackages.Add(ScriptPackageName, true);
+		}
+		else if (ReasonForChange == EModuleChangeReason::ModuleUnloaded)
+		{
+			PendingModulePackages.Add(ScriptPackageName, false);
+
+			// Enums outside the script package, such as enum assets referenced by the module, may have gone with it.
+			bPurgeDeadNodes = true;
+		}
+	}
+
+	void FEnumRegistry::AddEnumsInPackage(const FName& InPackageName)
+	{
+		const UPackage* Package = FindPackage(nullptr, *InPackageName.ToString());
+		if (!IsValid(Package))
+		{
+			return;
+		}
+
+		ForEachObjectWithOuter(
+			Package,
+			[this](UObject* Object)
+			{
+				const UEnum* Enum = Cast<UEnum>(Object);
+				if (IsValid(Enum) && !Snapshot->Contains(*Enum->GetPathName()))
+				{
+					const TSharedPtr<FEnumViewerNode> NewNode = MakeShared<FEnumViewerNode>(Enum);
+					if (Snapshot->AddNode(NewNode))
+					{
+						Snapshot->RefreshNode(*NewNode);
+						PendingDelta.AddedEnumPaths.Add(NewNode->GetEnumPath());
+					}
+				}
+			},
+			false
+		);
+	}
+
+	void FEnumRegistry::RemoveEnumsInPackage(const FName& InPackageName)
+	{
+		TArray<FName> EnumPathsInPackage;
+		Snapshot->GetEnumPathsInPackage(InPackageName, EnumPathsInPackage);
+		
+		for (const FName& EnumPath : EnumPathsInPackage)
+		{
+			if (Snapshot->RemoveNode(EnumPath))
+			{
+				PendingDelta.RemovedEnumPaths.Add(EnumPath);
+			}
+		}
+	}
+
+	void FEnumRegistry::OnAssetAdded(const FAssetData& InAssetData)
+	{
+		// The initial scan is covered by the rebuild performed when the files have been loaded.
+		if (FAssetRegistryModule::GetRegistry().IsLoadingAssets())
+		{
+			return;
+		}
+		
+		if (IsEnumAsset(InAssetData))
+		{
+			QueueAddedEnumAsset(InAssetData);
+		}
+	}
+
+	void FEnumRegistry::OnAssetRemoved(const FAssetData& InAssetData)
+	{
+		if (IsEnumAsset(InAssetData))
+		{
+			QueueRemovedEnumAsset(InAssetData.ObjectPath);
+		}
+	}
+
+	void FEnumRegistry::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+	{
+		if (IsEnumAsset(InAssetData))
+		{
+			QueueRemovedEnumAsset(*InOldObjectPath);
+			QueueAddedEnumAsset(InAssetData);
+		}
+	}
+
+	void FEnumRegistry::OnInMemoryAssetCreated(UObject* InObject)
+	{
+		if (const UUserDefinedEnum* UserDefinedEnum = Cast<UUserDefinedEnum>(InObject))
+		{
+			QueueAddedEnumAsset(FAssetData(UserDefinedEnum));
+		}
+	}
+
+	void FEnumRegistry::ProcessPendingChanges()
+	{
+		for (const auto& Pair : PendingModulePackages)
+		{
+			if (Pair.Value)
+			{
+				AddEnumsInPackage(Pair.Key);
+			}
+			else
+			{
+				RemoveEnumsInPackage(Pair.Key);
+			}
+		}
+		PendingModulePackages.Reset();
+
+		ProcessPendingEnumAssets();
+	}
+
+	void FEnumRegistry::QueueAddedEnumAsset(const FAssetData& InAssetData)
+	{
+		PendingRemovedEnumAssets.Remove(InAssetData.ObjectPath);
+		PendingAddedEnumAssets.Add(InAssetData.ObjectPath, InAssetData);
+	}
+
+	void FEnumRegistry::QueueRemovedEnumAsset(const FName& InObjectPath)
+	{
+		PendingAddedEnumAssets.Remove(InObjectPath);
+		PendingRemovedEnumAssets.Add(InObjectPath);
+	}
+
+	void FEnumRegistry::ProcessPendingEnumAssets()
+	{
+		for (const FName& RemovedObjectPath : PendingRemovedEnumAssets)
+		{
+			if (Snapshot->RemoveNode(RemovedObjectPath))
+			{
+				PendingDelta.RemovedEnumPaths.Add(RemovedObjectPath);
+			}
+		}
+		
+		Snapshot->Reserve(Snapshot->Num() + PendingAddedEnumAssets.Num());
+		for (const auto& Pair : PendingAddedEnumAssets)
+		{
+			// An enum asset deleted and recreated at the same path in a frame only has its add queued,
+			// and the existing node still refers to the deleted enum, so it's replaced with a new one.
+			const TSharedPtr<FEnumViewerNode> NewNode = MakeShared<FEnumViewerNode>(Pair.Value);
+			if (Snapshot->Contains(Pair.Key))
+			{
+				if (Snapshot->ReplaceNode(NewNode))
+				{
+					Snapshot->RefreshNode(*NewNode);
+					PendingDelta.RemovedEnumPaths.Add(Pair.Key);
+					PendingDelta.AddedEnumPaths.Add(Pair.Key);
+				}
+			}
+			else if (Snapshot->AddNode(NewNode))
+			{
+				Snapshot->RefreshNode(*NewNode);
+				PendingDelta.AddedEnumPaths.Add(Pair.Key);
+			}
+		}
+
+		PendingAddedEnumAssets.Reset();
+		PendingRemovedEnumAssets.Reset();
+	}
+
+	bool FEnumRegistry::IsEnumAsset(const FAssetData& InAssetData)
+	{
+		if (InAssetData.AssetClass == UUserDefinedEnum::StaticClass()->GetFName())
 		{
-			DirtyEnumRegistry();
+			return true;
 		}
+
+		// Derived classes of user defined enums are also included, as in the asset registry query.
+		if (const UClass* AssetClass = InAssetData.GetClass())
+		{
+			return AssetClass->IsChildOf(UUserDefinedEnum::StaticClass());
+		}
+
+		return false;
 	}
 
 	void FEnumRegistry::OnHotReload(bool bWasTriggeredAutomatically)
@@ -218,6 +993,19 @@ namespace EnumViewer
 		DirtyEnumRegistry();
 	}
 
+	void FEnumRegistry::OnCultureChanged()
+	{
+		// The display names are localized, so resolve them again in the new culture as they are displayed.
+		for (const TSharedPtr<FEnumViewerNode>& Node : Snapshot->GetNodes())
+		{
+			Node->ResetEnumDisplayNames();
+		}
+		InvalidateDisplayNameOrders();
+
+		// The rows hold the names they were generated with.
+		OnPopulateEnumViewer.Broadcast();
+	}
+
 	TUniquePtr<FEnumRegistry> FEnumRegistry::Instance;
 }
 
@@ -4,15 +4,55 @@
 
 #include "CoreMinimal.h"
 #include "EnumViewer/Data/EnumViewerNode.h"
+#include "EnumViewer/Data/EnumRegistrySnapshot.h"
+#include "EnumViewer/Utilities/EnumViewerSettings.h"
+#include "EnumViewer/Types/EnumViewerInitializationOptions.h"
+#include "AssetData.h"
+#include "Async/Future.h"
+#include "Kismet2/EnumEditorUtils.h"
 
 namespace EnumViewer
 {
-	class ENUMVIEWER_API FEnumRegistry : public FTickableGameObject
+	/**
+	 * The set of changes made to the Enum Registry since the last notification.
+	 */
+	struct FEnumRegistryDelta
+	{
+	public:
+		// The enum paths of the nodes added to the Enum Registry.
+		// A node replaced by a new one with the same enum path is listed here as well as in RemovedEnumPaths.
+		TArray<FName> AddedEnumPaths;
+
+		// The enum paths of the nodes removed from the Enum Registry.
+		TArray<FName> RemovedEnumPaths;
+
+	public:
+		// Returns whether there are no changes.
+		bool IsEmpty() const
+		{
+			return (AddedEnumPaths.Num() == 0 && RemovedEnumPaths.Num() == 0);
+		}
+
+		// Clears all recorded changes.
+		void Reset()
+		{
+			AddedEnumPaths.Reset();
+			RemovedEnumPaths.Reset();
+		}
+	};
+	
+	class ENUMVIEWER_API FEnumRegistry : public FTickableGameObject, public FEnumEditorUtils::INotifyOnEnumChanged
 	{
 	public:
 		// Defines an event to be called when the Enum Registry is updated.
 		DECLARE_MULTICAST_DELEGATE(FOnPopulateEnumViewer);
 
+		// Defines an event to be called when some nodes are added to or removed from the Enum Registry.
+		DECLARE_MULTICAST_DELEGATE_OneParam(FOnEnumRegistryChanged, const FEnumRegistryDelta& /* Delta */);
+
+		// Defines an event to be called when the Enum Registry starts or finishes being rebuilt.
+		DECLARE_MULTICAST_DELEGATE_OneParam(FOnPopulatingChanged, bool /* bIsPopulating */);
+
 	public:
 		// Constructor.
 		FEnumRegistry();
@@ -32,15 +72,121 @@ namespace EnumViewer
 		// Returns an event that will be called when the Enum Registry is updated.
 		FOnPopulateEnumViewer& GetOnPopulateEnumViewer();
 
-		// Returns a list of enums registered in the Enum Registry that meet the conditions.
-		TArray<TSharedPtr<FEnumViewerNode>> GetNodeList(
-			const TSharedPtr<IPropertyHandle>& InPropertyHandle,
-			TFunction<bool(const TSharedPtr<FEnumViewerNode>& EnumViewerNode)> FilterPredicate
+		// Returns an event that will be called when some nodes are added to or removed from the Enum Registry.
+		FOnEnumRegistryChanged& GetOnEnumRegistryChanged();
+
+		// Returns an event that will be called when the Enum Registry starts or finishes being rebuilt.
+		FOnPopulatingChanged& GetOnPopulatingChanged();
+
+		// Returns the snapshot currently published, whose columns can be read by filters.
+		const FEnumRegistrySnapshot& GetSnapshot() const;
+
+		// Returns the shared pointer to the snapshot currently published, for work that holds on to it across frames.
+		const FEnumRegistrySnapshotPtr& GetSnapshotPtr() const;
+		
+		// Appends the registry indices of the candidates that pass the filter, keeping their order.
+		// The filter receives a range of candidates and appends the ones that pass, so that it can do any setup once per range.
+		// If the filter is thread safe, large ranges are split into chunks and filtered in parallel.
+		// The result is the same as filtering them in order either way.
+		static void FilterNodeIndices(
+			TFunctionRef<void(TArrayView<const int32> CandidateIndices, TArray<int32>& OutPassedIndices)> BatchFilter,
+			TArrayView<const int32> InCandidateIndices,
+			TArray<int32>& OutNodeIndices,
+			const bool bIsFilterThreadSafe = false
+		);
+
+		// Returns the registry indices of all the nodes in the specified order, with ties in alphabetical order.
+		// The alphabetical order is maintained by the snapshot as nodes are added and removed,
+		// and the others are sorted by cached keys once per generation of the snapshot.
+		// The display name order follows the names as the viewer displays them with the specified name type.
+		const TArray<int32>& GetSortedNodeIndices(
+			const EEnumViewerSortType InSortType = EEnumViewerSortType::Name,
+			const EEnumViewerNameTypeToDisplay InNameType = EEnumViewerNameTypeToDisplay::DisplayName
 		) const;
 
+		// Records that the enum has been picked in a viewer, for sorting by when the enums were last picked.
+		void NotifyEnumPicked(const FName& InEnumPath);
+
+		// Classifies the enum paths of the current snapshot for the visibility filters of the viewers.
+		// The classifier is compiled again first if the project settings have changed.
+		void ClassifyPaths();
+
 		// Returns the enum viewer node for the specified enum path.
 		TSharedPtr<FEnumViewerNode> FindNodeByEnumPath(const FName& InEnumPath);
 
+		// Called when the enum of a node has been loaded, reset or edited, to update the columns read from it
+		// and the orders that depend on it. Nodes that are not in the current snapshot are ignored.
+		void OnNodeEnumChanged(const FEnumViewerNode& InNode);
+
+		// Returns the approximate amount of memory allocated by the Enum Registry.
+		SIZE_T GetAllocatedSize() const;
+
+		// Prints the number of enums and the memory footprint of the Enum Registry to the log.
+		void DumpStats() const;
+
+		// Returns whether the Enum Registry is being rebuilt, either in the background or time-sliced.
+		bool IsPopulating() const;
+
+		// Registers and unregisters an enum viewer that displays the Enum Registry.
+		// Rebuilds are deferred while no viewer is registered.
+		void RegisterViewer();
+		void UnregisterViewer();
+
+	private:
+		/**
+		 * The nodes sorted in an order other than by enum name, cached until the snapshot changes.
+		 */
+		struct FSortedNodeIndices
+		{
+		public:
+			// The generation of the snapshot that the nodes were sorted for, or zero if they need to be sorted.
+			uint32 Generation = 0;
+
+			// The registry indices of the nodes in order.
+			TArray<int32> NodeIndices;
+		};
+
+		/**
+		 * A loaded enum collected for a rebuild in the background, with the names read from it on the game thread.
+		 */
+		struct FLoadedEnum
+		{
+		public:
+			// The enum, which must not be dereferenced on the worker thread.
+			TWeakObjectPtr<const UEnum> Enum;
+
+			// The interned name of the enum.
+			FName EnumName;
+
+			// The full object path to the enum.
+			FName EnumPath;
+
+			// The name of the package that contains the enum.
+			FName PackageName;
+		};
+
+		/**
+		 * The remaining work of a rebuild that updates the current snapshot a little at a time on the game thread.
+		 */
+		struct FTimeSlicedRebuild
+		{
+		public:
+			// The enums collected when the rebuild started.
+			TArray<TWeakObjectPtr<const UEnum>> Enums;
+
+			// The enum assets collected when the rebuild started.
+			TArray<FAssetData> EnumAssets;
+
+			// The index of the next enum to visit.
+			int32 NextEnumIndex = 0;
+
+			// The index of the next enum asset to visit.
+			int32 NextEnumAssetIndex = 0;
+
+			// The enum paths visited so far. Nodes not in this set are removed when the rebuild finishes.
+			TSet<FName> VisitedEnumPaths;
+		};
+		
 	private:
 		// FTickableObjectBase interface.
 		virtual void Tick(float DeltaTime) override;
@@ -52,18 +198,102 @@ namespace EnumViewer
 		virtual bool IsTickableWhenPaused() const override;
 		virtual bool IsTickableInEditor() const override;
 		// End of FTickableGameObject interface.
+
+		// FEnumEditorUtils::INotifyOnEnumChanged interface.
+		virtual void PreChange(const UUserDefinedEnum* Changed, FEnumEditorUtils::EEnumEditorChangeInfo ChangedType) override;
+		virtual void PostChange(const UUserDefinedEnum* Changed, FEnumEditorUtils::EEnumEditorChangeInfo ChangedType) override;
+		// End of FEnumEditorUtils::INotifyOnEnumChanged interface.
 		
-		// Dirty the enum list so it will be rebuilt on the next call to UpdateEnumRegistry.
+		// Dirty the enum list so it will be rebuilt once the debounce time has passed.
 		void DirtyEnumRegistry();
+
+		// Sorts the registry indices of all the nodes in the specified order other than by enum name.
+		void SortNodeIndices(const EEnumViewerSortType InSortType, const EEnumViewerNameTypeToDisplay InNameType, TArray<int32>& OutNodeIndices) const;
+
+		// Discards the display name orders of all the name types, such as when display names are resolved again.
+		void InvalidateDisplayNameOrders();
+
+		// Returns whether the enum list is dirty and the debounce time has passed.
+		bool ShouldPopulateEnumRegistry() const;
 		
-		// Populates the enum list, pulling all the loaded and unloaded enums into a master data list.
+		// Starts building a new snapshot in the background, pulling all the loaded and unloaded enums into a master data list.
+		// At most one build runs at a time, and a request made while building is deferred until it completes.
 		void PopulateEnumRegistry();
 
+		// Publishes the snapshot built in the background and notifies the viewers.
+		void FinishPopulateEnumRegistry();
+
+		// Advances the time-sliced rebuild until the frame budget runs out.
+		void TickTimeSlicedRebuild();
+
+		// Removes the nodes that were not visited by the time-sliced rebuild and ends it.
+		void FinishTimeSlicedRebuild();
+
+		// Builds a new snapshot from the collected enums and enum assets. This is called on a worker thread.
+		// The enums are not dereferenced here, as everything needed from them has been read on the game thread.
+		// The trigram index is also built here if requested, so that publishing the snapshot doesn't stall the game thread.
+		static FEnumRegistrySnapshotPtr BuildSnapshot(
+			const TArray<FLoadedEnum>& InEnums,
+			const TArray<FAssetData>& InEnumAssets,
+			const bool bInBuildTrigramIndex
+		);
+
+		// Called when the internal only paths or enums, or the search index settings in the project settings have changed.
+		void OnProjectSettingChanged();
+
+		// Returns whether a snapshot with the specified number of nodes should have a trigram index.
+		static bool ShouldUseTrigramIndex(const int32 InNumNodes);
+
+		// Builds or discards the trigram index of the current snapshot as the project settings and its size require.
+		void UpdateTrigramIndex();
+
+		// Called after garbage collection has finished.
+		void OnPostGarbageCollect();
+
+		// Removes the nodes whose enums no longer exist, and returns enum assets that still exist on disk to the unloaded state.
+		void PurgeDeadNodes();
+
 		// Called when modules are loaded or unloaded.
 		void OnModulesChanged(FName ModuleThatChanged, EModuleChangeReason ReasonForChange);
 		
+		// Adds the enums contained in the specified package to the list.
+		void AddEnumsInPackage(const FName& InPackageName);
+
+		// Removes the enums contained in the specified package from the list.
+		void RemoveEnumsInPackage(const FName& InPackageName);
+
+		// Called when an asset is added to the asset registry.
+		void OnAssetAdded(const FAssetData& InAssetData);
+
+		// Called when an asset is removed from the asset registry.
+		void OnAssetRemoved(const FAssetData& InAssetData);
+
+		// Called when an asset is renamed in the asset registry.
+		void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+
+		// Called when an asset is created in memory.
+		void OnInMemoryAssetCreated(UObject* InObject);
+
+		// Applies the module and enum asset changes queued during this frame to the list.
+		void ProcessPendingChanges();
+
+		// Queues the enum asset to be added to the list on the next tick.
+		void QueueAddedEnumAsset(const FAssetData& InAssetData);
+
+		// Queues the enum asset to be removed from the list on the next tick.
+		void QueueRemovedEnumAsset(const FName& InObjectPath);
+
+		// Applies the enum asset changes queued during this frame to the list.
+		void ProcessPendingEnumAssets();
+
+		// Returns whether the asset is an enum asset.
+		static bool IsEnumAsset(const FAssetData& InAssetData);
+
 		// Called when hot reload has finished.
 		void OnHotReload(bool bWasTriggeredAutomatically);
+
+		// Called when the current culture has changed.
+		void OnCultureChanged();
 	
 	private:
 		// The instance of enum registry singleton that manages the unfiltered enum tree for the Enum Viewer.
@@ -72,10 +302,63 @@ namespace EnumViewer
 		// The event called when the Enum Registry is updated.
 		FOnPopulateEnumViewer OnPopulateEnumViewer;
 
+		// The event called when some nodes are added to or removed from the Enum Registry.
+		FOnEnumRegistryChanged OnEnumRegistryChanged;
+
+		// The event called when the Enum Registry starts or finishes being rebuilt.
+		FOnPopulatingChanged OnPopulatingChanged;
+
+		// The changes that have not yet been notified to the viewers.
+		FEnumRegistryDelta PendingDelta;
+
+		// The script packages of the modules loaded (true) or unloaded (false) during this frame.
+		TMap<FName, bool> PendingModulePackages;
+
+		// The enum assets added or renamed during this frame, keyed by object path.
+		TMap<FName, FAssetData> PendingAddedEnumAssets;
+
+		// The object paths of the enum assets removed or renamed during this frame.
+		TSet<FName> PendingRemovedEnumAssets;
+
 		// Whether the Enum Registry needs to be refreshed.
 		bool bRefreshEnumHierarchy = false;
 
-		// The list of enum data collected by the Enum Registry.
-		TArray<TSharedPtr<FEnumViewerNode>> EnumNodes;
+		// Whether some enums may have been destroyed since the last purge.
+		bool bPurgeDeadNodes = false;
+
+		// The time when the Enum Registry was last dirtied.
+		double LastDirtyTime = 0.0;
+
+		// The snapshot of enum data currently published by the Enum Registry.
+		FEnumRegistrySnapshotPtr Snapshot;
+
+		// The task that builds the next snapshot in the background.
+		TFuture<FEnumRegistrySnapshotPtr> PopulateTask;
+
+		// The rebuild in progress if the rebuild mode is time-sliced.
+		TUniquePtr<FTimeSlicedRebuild> TimeSlicedRebuild;
+
+		// The classifier compiled from the project settings.
+		FEnumPathClassifier PathClassifier;
+
+		// Whether the classifier needs to be compiled before it's used next.
+		bool bPathClassifierDirty = true;
+
+		// The number of enum viewers currently displaying the Enum Registry.
+		int32 NumViewers = 0;
+
+		// The orders of the nodes other than by enum name, indexed by sort type and sorted on first use.
+		// The display name order is kept in SortedNodeIndicesByNameType instead.
+		mutable FSortedNodeIndices SortedNodeIndicesBySortType[static_cast<int32>(EEnumViewerSortType::Max)];
+
+		// The display name orders of the nodes, keyed by the name type the viewers display and sorted on first use.
+		mutable TMap<uint8, FSortedNodeIndices> SortedNodeIndicesByNameType;
+
+		// The number of times an enum has been picked when each enum was last picked, keyed by enum path.
+		// This orders the picks without depending on the clock.
+		TMap<FName, uint64> LastPickSerials;
+
+		// The number of times an enum has been picked in this session.
+		uint64 NumPicks = 0;
 	};
 }
@@ -0,0 +1,433 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumRegistrySnapshot.h"
+#include "EnumViewer/Data/EnumViewerNode.h"
+#include "HAL/ThreadSafeCounter.h"
+
+namespace EnumViewer
+{
+	namespace EnumRegistrySnapshotInternal
+	{
+		// The prefix of the packages that native enums belong to.
+		static const FString ScriptPackagePrefix = TEXT("/Script/");
+
+		// Returns a generation that no snapshot has had before.
+		// Snapshots are built on worker threads, so the counter is shared safely between them.
+		static uint32 MakeGeneration()
+		{
+			static FThreadSafeCounter LastGeneration;
+			return static_cast<uint32>(LastGeneration.Increment());
+		}
+
+		// Returns the name of the module of a native enum, such as "Engine" for "/Script/Engine",
+		// or the mount point of an enum asset, such as "Game" for "/Game/AI/E_State".
+		static FName GetModuleName(const FString& InPackageName)
+		{
+			if (InPackageName.StartsWith(ScriptPackagePrefix, ESearchCase::CaseSensitive))
+			{
+				return FName(*InPackageName.Mid(ScriptPackagePrefix.Len()));
+			}
+
+			const int32 MountPointEnd = InPackageName.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, 1);
+			return FName(*InPackageName.Mid(1, (MountPointEnd != INDEX_NONE ? MountPointEnd : InPackageName.Len()) - 1));
+		}
+
+		// The traits that only depend on the package, which are known without reading the enum.
+		static constexpr EEnumTraitFlags OriginTraitFlags = (EEnumTraitFlags::Native | EEnumTraitFlags::Asset);
+
+		// Returns whether the enum is native or an asset from the name of its package.
+		static EEnumTraitFlags GetOriginTraitFlags(const FString& InPackageName)
+		{
+			return (
+				InPackageName.StartsWith(ScriptPackagePrefix, ESearchCase::CaseSensitive) ?
+				EEnumTraitFlags::Native : EEnumTraitFlags::Asset
+			);
+		}
+
+		// Returns the traits read from the enum, which are none if it's not loaded.
+		// The meta data isn't safe to read while it can be modified, so this must be called on the game thread.
+		static EEnumTraitFlags GetEnumTraitFlags(const UEnum* InEnum)
+		{
+			check(IsInGameThread());
+			
+			EEnumTraitFlags Flags = EEnumTraitFlags::None;
+			if (InEnum != nullptr)
+			{
+				if (InEnum->HasMetaData(TEXT("Bitflags")))
+				{
+					Flags |= EEnumTraitFlags::Bitmask;
+				}
+				if (InEnum->GetCppForm() == UEnum::ECppForm::EnumClass)
+				{
+					Flags |= EEnumTraitFlags::EnumClass;
+				}
+			}
+
+			return Flags;
+		}
+
+		// Returns the number of values of the enum excluding the generated _MAX value, or INDEX_NONE if it's not loaded.
+		static int32 GetNumValues(const UEnum* InEnum)
+		{
+			if (InEnum != nullptr)
+			{
+				return (InEnum->NumEnums() - (InEnum->ContainsExistingMax() ? 1 : 0));
+			}
+
+			return INDEX_NONE;
+		}
+	}
+
+	const TArray<TSharedPtr<FEnumViewerNode>>& FEnumRegistrySnapshot::GetNodes() const
+	{
+		return EnumNodes;
+	}
+
+	const TSharedPtr<FEnumViewerNode>& FEnumRegistrySnapshot::GetNode(const int32 InIndex) const
+	{
+		return EnumNodes[InIndex];
+	}
+
+	const TArray<FName>& FEnumRegistrySnapshot::GetEnumNames() const
+	{
+		return EnumNames;
+	}
+
+	const TArray<FName>& FEnumRegistrySnapshot::GetEnumPaths() const
+	{
+		return EnumPaths;
+	}
+
+	const TArray<FName>& FEnumRegistrySnapshot::GetPackageNames() const
+	{
+		return PackageNames;
+	}
+
+	const TArray<EEnumPathFlags>& FEnumRegistrySnapshot::GetPathFlags() const
+	{
+		return PathFlags;
+	}
+
+	const TArray<FName>& FEnumRegistrySnapshot::GetModuleNames() const
+	{
+		return ModuleNames;
+	}
+
+	const TArray<EEnumTraitFlags>& FEnumRegistrySnapshot::GetTraitFlags() const
+	{
+		return TraitFlags;
+	}
+
+	const TArray<int32>& FEnumRegistrySnapshot::GetNumValues() const
+	{
+		return NumValues;
+	}
+
+	void FEnumRegistrySnapshot::ClassifyPaths(const FEnumPathClassifier& InClassifier)
+	{
+		if (PathFlagsSerial != InClassifier.GetSerial())
+		{
+			PathFlagsSerial = InClassifier.GetSerial();
+			for (EEnumPathFlags& Flags : PathFlags)
+			{
+				Flags = EEnumPathFlags::None;
+			}
+		}
+
+		FString Buffer;
+		for (int32 Index = 0; Index < PathFlags.Num(); Index++)
+		{
+			if (PathFlags[Index] == EEnumPathFlags::None)
+			{
+				PathFlags[Index] = InClassifier.Classify(EnumPaths[Index], Buffer);
+			}
+		}
+	}
+
+	const FEnumSearchKeys& FEnumRegistrySnapshot::GetSearchKeys() const
+	{
+		// Rebuilding the whole buffer is a single pass over the names,
+		// and keeps it ordered by registry index regardless of how the nodes have been moved.
+		if (bSearchKeysDirty)
+		{
+			SearchKeys.Build(EnumNames);
+			bSearchKeysDirty = false;
+		}
+
+		return SearchKeys;
+	}
+
+	void FEnumRegistrySnapshot::SetTrigramIndexEnabled(const bool bInEnabled)
+	{
+		if (!bInEnabled)
+		{
+			TrigramIndex.Reset();
+		}
+		else if (!TrigramIndex.IsValid())
+		{
+			TrigramIndex = MakeUnique<FEnumTrigramIndex>();
+			TrigramIndex->Build(EnumNames);
+		}
+	}
+
+	const FEnumTrigramIndex* FEnumRegistrySnapshot::GetTrigramIndex() const
+	{
+		return TrigramIndex.Get();
+	}
+
+	const TArray<int32>& FEnumRegistrySnapshot::GetSortedNodeIndices() const
+	{
+		return SortOrder.GetSortedNodeIndices(EnumNames, EnumPaths);
+	}
+
+	uint32 FEnumRegistrySnapshot::GetGeneration() const
+	{
+		return Generation;
+	}
+
+	int32 FEnumRegistrySnapshot::Num() const
+	{
+		return EnumNodes.Num();
+	}
+
+	SIZE_T FEnumRegistrySnapshot::GetAllocatedSize() const
+	{
+		return (
+			EnumNodes.GetAllocatedSize() +
+			EnumNodes.Num() * sizeof(FEnumViewerNode) +
+			EnumNames.GetAllocatedSize() +
+			EnumPaths.GetAllocatedSize() +
+			PackageNames.GetAllocatedSize() +
+			PathFlags.GetAllocatedSize() +
+			ModuleNames.GetAllocatedSize() +
+			TraitFlags.GetAllocatedSize() +
+			NumValues.GetAllocatedSize() +
+			SearchKeys.GetAllocatedSize() +
+			(TrigramIndex.IsValid() ? TrigramIndex->GetAllocatedSize() : 0) +
+			SortOrder.GetAllocatedSize() +
+			EnumNodeIndices.GetAllocatedSize() +
+			EnumPathsByPackage.GetAllocatedSize()
+		);
+	}
+
+	bool FEnumRegistrySnapshot::Contains(const FName& InEnumPath) const
+	{
+		return EnumNodeIndices.Contains(InEnumPath);
+	}
+
+	TSharedPtr<FEnumViewerNode> FEnumRegistrySnapshot::FindNode(const FName& InEnumPath) const
+	{
+		if (const int32* FoundIndex = EnumNodeIndices.Find(InEnumPath))
+		{
+			return EnumNodes[*FoundIndex];
+		}
+
+		return nullptr;
+	}
+
+	void FEnumRegistrySnapshot::GetEnumPathsInPackage(const FName& InPackageName, TArray<FName>& OutEnumPaths) const
+	{
+		EnumPathsByPackage.MultiFind(InPackageName, OutEnumPaths);
+	}
+
+	bool FEnumRegistrySnapshot::AddNode(const TSharedPtr<FEnumViewerNode>& InNode)
+	{
+		if (!InNode.IsValid() || EnumNodeIndices.Contains(InNode->GetEnumPath()))
+		{
+			return false;
+		}
+
+		const int32 NewIndex = EnumNodes.Add(InNode);
+		EnumNames.Add(InNode->GetEnumFName());
+		EnumPaths.Add(InNode->GetEnumPath());
+		PackageNames.Add(InNode->GetPackageName());
+		PathFlags.Add(EEnumPathFlags::None);
+		const FString PackageName = InNode->GetPackageName().ToString();
+		ModuleNames.Add(EnumRegistrySnapshotInternal::GetModuleName(PackageName));
+		TraitFlags.Add(EnumRegistrySnapshotInternal::GetOriginTraitFlags(PackageName));
+		NumValues.Add(INDEX_NONE);
+		bSearchKeysDirty = true;
+		if (TrigramIndex.IsValid())
+		{
+			TrigramIndex->AddNode(NewIndex, InNode->GetEnumFName());
+		}
+		SortOrder.AddNode(NewIndex, InNode->GetEnumFName());
+		Generation = EnumRegistrySnapshotInternal::MakeGeneration();
+		EnumNodeIndices.Add(InNode->GetEnumPath(), NewIndex);
+		InNode->RegistryIndex = NewIndex;
+		EnumPathsByPackage.Add(InNode->GetPackageName(), InNode->GetEnumPath());
+		return true;
+	}
+
+	bool FEnumRegistrySnapshot::ReplaceNode(const TSharedPtr<FEnumViewerNode>& InNode)
+	{
+		if (!InNode.IsValid())
+		{
+			return false;
+		}
+
+		const int32* FoundIndex = EnumNodeIndices.Find(InNode->GetEnumPath());
+		if (FoundIndex == nullptr)
+		{
+			return false;
+		}
+
+		// The enum path decides the name and the package, so only the columns read from the enum can differ.
+		const int32 Index = *FoundIndex;
+		check(EnumNames[Index] == InNode->GetEnumFName() && PackageNames[Index] == InNode->GetPackageName());
+		EnumNodes[Index]->RegistryIndex = INDEX_NONE;
+		EnumNodes[Index] = InNode;
+		InNode->RegistryIndex = Index;
+		TraitFlags[Index] &= EnumRegistrySnapshotInternal::OriginTraitFlags;
+		NumValues[Index] = INDEX_NONE;
+		Generation = EnumRegistrySnapshotInternal::MakeGeneration();
+		return true;
+	}
+
+	bool FEnumRegistrySnapshot::RefreshNode(const FEnumViewerNode& InNode)
+	{
+		const int32 Index = InNode.RegistryIndex;
+		if (!EnumNodes.IsValidIndex(Index) || EnumNodes[Index].Get() != &InNode)
+		{
+			return false;
+		}
+
+		const UEnum* Enum = InNode.GetEnum();
+		const EEnumTraitFlags NewTraitFlags = (
+			(TraitFlags[Index] & EnumRegistrySnapshotInternal::OriginTraitFlags) |
+			EnumRegistrySnapshotInternal::GetEnumTraitFlags(Enum)
+		);
+		const int32 NewNumValues = EnumRegistrySnapshotInternal::GetNumValues(Enum);
+		if (TraitFlags[Index] == NewTraitFlags && NumValues[Index] == NewNumValues)
+		{
+			return false;
+		}
+
+		TraitFlags[Index] = NewTraitFlags;
+		NumValues[Index] = NewNumValues;
+		return true;
+	}
+
+	void FEnumRegistrySnapshot::RefreshAllNodes()
+	{
+		for (const TSharedPtr<FEnumViewerNode>& Node : EnumNodes)
+		{
+			RefreshNode(*Node);
+		}
+	}
+
+	bool FEnumRegistrySnapshot::RemoveNode(const FName& InEnumPath)
+	{
+		int32 RemovedIndex = INDEX_NONE;
+		if (!EnumNodeIndices.RemoveAndCopyValue(InEnumPath, RemovedIndex))
+		{
+			return false;
+		}
+
+		EnumPathsByPackage.RemoveSingle(PackageNames[RemovedIndex], InEnumPath);
+		EnumNodes[RemovedIndex]->RegistryIndex = INDEX_NONE;
+		if (TrigramIndex.IsValid())
+		{
+			TrigramIndex->RemoveNode(RemovedIndex, EnumNames[RemovedIndex]);
+		}
+		SortOrder.RemoveNode(RemovedIndex, EnumNames, EnumPaths);
+		Generation = EnumRegistrySnapshotInternal::MakeGeneration();
+
+		// Move the last node into the vacated slot and update its index so that removal stays constant time.
+		EnumNodes.RemoveAtSwap(RemovedIndex, 1, false);
+		EnumNames.RemoveAtSwap(RemovedIndex, 1, false);
+		EnumPaths.RemoveAtSwap(RemovedIndex, 1, false);
+		PackageNames.RemoveAtSwap(RemovedIndex, 1, false);
+		PathFlags.RemoveAtSwap(RemovedIndex, 1, false);
+		ModuleNames.RemoveAtSwap(RemovedIndex, 1, false);
+		TraitFlags.RemoveAtSwap(RemovedIndex, 1, false);
+		NumValues.RemoveAtSwap(RemovedIndex, 1, false);
+		bSearchKeysDirty = true;
+		if (EnumNodes.IsValidIndex(RemovedIndex))
+		{
+			EnumNodeIndices.Add(EnumPaths[RemovedIndex], RemovedIndex);
+			EnumNodes[RemovedIndex]->RegistryIndex = RemovedIndex;
+			if (TrigramIndex.IsValid())
+			{
+				TrigramIndex->MoveNode(EnumNodes.Num(), RemovedIndex, EnumNames[RemovedIndex]);
+			}
+		}
+
+		return true;
+	}
+
+	int32 FEnumRegistrySnapshot::RemoveNodes(TFunctionRef<bool(const FEnumViewerNode& Node)> Predicate, TArray<FName>& OutRemovedEnumPaths)
+	{
+		const int32 NumNodes = EnumNodes.Num();
+		TArray<int32> NewNodeIndices;
+		NewNodeIndices.SetNumUninitialized(NumNodes);
+		int32 WriteIndex = 0;
+		for (int32 ReadIndex = 0; ReadIndex < NumNodes; ReadIndex++)
+		{
+			FEnumViewerNode& Node = *EnumNodes[ReadIndex];
+			if (Predicate(Node))
+			{
+				NewNodeIndices[ReadIndex] = INDEX_NONE;
+				EnumNodeIndices.Remove(EnumPaths[ReadIndex]);
+				EnumPathsByPackage.RemoveSingle(PackageNames[ReadIndex], EnumPaths[ReadIndex]);
+				OutRemovedEnumPaths.Add(EnumPaths[ReadIndex]);
+				Node.RegistryIndex = INDEX_NONE;
+				continue;
+			}
+
+			// Shift the remaining nodes down over the removed ones.
+			if (WriteIndex != ReadIndex)
+			{
+				EnumNodes[WriteIndex] = MoveTemp(EnumNodes[ReadIndex]);
+				EnumNames[WriteIndex] = EnumNames[ReadIndex];
+				EnumPaths[WriteIndex] = EnumPaths[ReadIndex];
+				PackageNames[WriteIndex] = PackageNames[ReadIndex];
+				PathFlags[WriteIndex] = PathFlags[ReadIndex];
+				ModuleNames[WriteIndex] = ModuleNames[ReadIndex];
+				TraitFlags[WriteIndex] = TraitFlags[ReadIndex];
+				NumValues[WriteIndex] = NumValues[ReadIndex];
+				EnumNodeIndices.FindChecked(EnumPaths[WriteIndex]) = WriteIndex;
+				Node.RegistryIndex = WriteIndex;
+			}
+			NewNodeIndices[ReadIndex] = WriteIndex;
+			WriteIndex++;
+		}
+
+		const int32 NumRemoved = (NumNodes - WriteIndex);
+		if (NumRemoved > 0)
+		{
+			EnumNodes.SetNum(WriteIndex, false);
+			EnumNames.SetNum(WriteIndex, false);
+			EnumPaths.SetNum(WriteIndex, false);
+			PackageNames.SetNum(WriteIndex, false);
+			PathFlags.SetNum(WriteIndex, false);
+			ModuleNames.SetNum(WriteIndex, false);
+			TraitFlags.SetNum(WriteIndex, false);
+			NumValues.SetNum(WriteIndex, false);
+			bSearchKeysDirty = true;
+			SortOrder.RemoveNodes(NewNodeIndices);
+			Generation = EnumRegistrySnapshotInternal::MakeGeneration();
+
+			// Most of the remaining nodes have been moved, so rebuilding is cheaper than patching each posting.
+			if (TrigramIndex.IsValid())
+			{
+				TrigramIndex->Build(EnumNames);
+			}
+		}
+
+		return NumRemoved;
+	}
+
+	void FEnumRegistrySnapshot::Reserve(const int32 InNumNodes)
+	{
+		EnumNodes.Reserve(InNumNodes);
+		EnumNames.Reserve(InNumNodes);
+		EnumPaths.Reserve(InNumNodes);
+		PackageNames.Reserve(InNumNodes);
+		PathFlags.Reserve(InNumNodes);
+		ModuleNames.Reserve(InNumNodes);
+		TraitFlags.Reserve(InNumNodes);
+		NumValues.Reserve(InNumNodes);
+		EnumNodeIndices.Reserve(InNumNodes);
+	}
+}
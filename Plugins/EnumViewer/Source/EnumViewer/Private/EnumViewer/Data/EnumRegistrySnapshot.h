@@ -0,0 +1,188 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnumViewer/Data/EnumPathClassifier.h"
+#include "EnumViewer/Data/EnumSearchKeys.h"
+#include "EnumViewer/Data/EnumTrigramIndex.h"
+#include "EnumViewer/Data/EnumSortOrder.h"
+
+namespace EnumViewer
+{
+	class FEnumViewerNode;
+
+	/**
+	 * The traits of an enum that can be searched for with keyed expressions such as "Type:Asset" or "Flags:Bitmask".
+	 */
+	enum class EEnumTraitFlags : uint8
+	{
+		None = 0,
+		// The enum is declared in C++.
+		Native = 1 << 0,
+		// The enum is a user defined enum asset.
+		Asset = 1 << 1,
+		// The enum is marked with the Bitflags meta data.
+		Bitmask = 1 << 2,
+		// The enum is declared as an enum class.
+		EnumClass = 1 << 3,
+	};
+	ENUM_CLASS_FLAGS(EEnumTraitFlags);
+
+	/**
+	 * A set of enum nodes collected by the Enum Registry.
+	 * A new snapshot is built on a worker thread and then published to the game thread as a whole,
+	 * after which it is only accessed from the game thread.
+	 * A published snapshot is not immutable: the registry keeps updating it in place as enums are added, removed or replaced,
+	 * and a time-sliced rebuild does the same. Each of those changes bumps the generation and may move registry indices,
+	 * so anything that holds on to registry indices or to the columns across frames must check the generation before using them.
+	 * The data used for filtering and sorting is also stored in contiguous columns indexed by the registry index of the node,
+	 * so that those can be done without dereferencing each node.
+	 */
+	class FEnumRegistrySnapshot
+	{
+	public:
+		// Returns the list of enum nodes in this snapshot.
+		const TArray<TSharedPtr<FEnumViewerNode>>& GetNodes() const;
+
+		// Returns the enum node at the specified registry index.
+		const TSharedPtr<FEnumViewerNode>& GetNode(const int32 InIndex) const;
+
+		// Returns the interned names of the enums, indexed by registry index.
+		const TArray<FName>& GetEnumNames() const;
+
+		// Returns the full object paths of the enums, indexed by registry index.
+		const TArray<FName>& GetEnumPaths() const;
+
+		// Returns the names of the packages that contain the enums, indexed by registry index.
+		const TArray<FName>& GetPackageNames() const;
+
+		// Returns the classifications of the enum paths, indexed by registry index.
+		// These are only up to date after calling ClassifyPaths.
+		const TArray<EEnumPathFlags>& GetPathFlags() const;
+
+		// Returns the names of the modules or mount points that contain the enums, indexed by registry index.
+		const TArray<FName>& GetModuleNames() const;
+
+		// Returns the traits of the enums, indexed by registry index.
+		// Only the Native and Asset flags are known for the enums that are not loaded, or whose nodes have not been refreshed yet.
+		const TArray<EEnumTraitFlags>& GetTraitFlags() const;
+
+		// Returns the number of values of the enums excluding the generated _MAX value, indexed by registry index.
+		// This is INDEX_NONE for the enums that are not loaded, or whose nodes have not been refreshed yet.
+		const TArray<int32>& GetNumValues() const;
+
+		// Classifies the paths of the nodes that have not been classified by the specified classifier yet.
+		// All paths are classified again if the classifier has been compiled since the last call.
+		void ClassifyPaths(const FEnumPathClassifier& InClassifier);
+
+		// Returns the case-folded search keys of the enum names, rebuilding them first if nodes have been added or removed.
+		const FEnumSearchKeys& GetSearchKeys() const;
+
+		// Builds or discards the trigram index of the enum names.
+		// While it exists, the index is updated as nodes are added and removed.
+		void SetTrigramIndexEnabled(const bool bInEnabled);
+
+		// Returns the trigram index of the enum names, or null if it's disabled.
+		const FEnumTrigramIndex* GetTrigramIndex() const;
+
+		// Returns the registry indices of all the nodes sorted alphabetically by enum name.
+		// The order is kept up to date as nodes are added and removed, so it never has to be sorted from scratch.
+		const TArray<int32>& GetSortedNodeIndices() const;
+
+		// Returns a number that changes every time nodes are added to or removed from this snapshot.
+		// It's unique across snapshots, so data derived from a snapshot can be cached by the generation alone.
+		uint32 GetGeneration() const;
+
+		// Returns the number of enum nodes in this snapshot.
+		int32 Num() const;
+
+		// Returns the approximate amount of memory allocated by this snapshot, including the nodes.
+		SIZE_T GetAllocatedSize() const;
+
+		// Returns whether a node for the specified enum path is contained in this snapshot.
+		bool Contains(const FName& InEnumPath) const;
+
+		// Returns the enum viewer node for the specified enum path.
+		TSharedPtr<FEnumViewerNode> FindNode(const FName& InEnumPath) const;
+
+		// Gets the enum paths contained in the specified package.
+		void GetEnumPathsInPackage(const FName& InPackageName, TArray<FName>& OutEnumPaths) const;
+
+		// Adds the node if no node with the same enum path is contained yet.
+		bool AddNode(const TSharedPtr<FEnumViewerNode>& InNode);
+
+		// Replaces the node with the same enum path, such as when an enum asset has been recreated at the same path.
+		// The new node takes over the registry index, so the order and the indices of the other nodes don't change.
+		bool ReplaceNode(const TSharedPtr<FEnumViewerNode>& InNode);
+
+		// Updates the columns read from the enum of the node, such as after it has been loaded or reset.
+		// Added and replaced nodes only have the columns known from their paths until this is called on the game thread.
+		// Returns whether any of the columns have changed.
+		bool RefreshNode(const FEnumViewerNode& InNode);
+
+		// Updates the columns read from the enums of all the nodes. This must be called on the game thread.
+		void RefreshAllNodes();
+
+		// Removes the node for the specified enum path.
+		bool RemoveNode(const FName& InEnumPath);
+
+		// Removes all the nodes that match the predicate in a single pass, keeping the order of the remaining nodes.
+		// Returns the number of removed nodes.
+		int32 RemoveNodes(TFunctionRef<bool(const FEnumViewerNode& Node)> Predicate, TArray<FName>& OutRemovedEnumPaths);
+
+		// Reserves memory for the specified number of nodes.
+		void Reserve(const int32 InNumNodes);
+
+	private:
+		// The list of enum nodes in this snapshot.
+		TArray<TSharedPtr<FEnumViewerNode>> EnumNodes;
+
+		// The interned names of the enums.
+		TArray<FName> EnumNames;
+
+		// The full object paths of the enums.
+		TArray<FName> EnumPaths;
+
+		// The names of the packages that contain the enums.
+		TArray<FName> PackageNames;
+
+		// The classifications of the enum paths, cached until the classifier is compiled again.
+		TArray<EEnumPathFlags> PathFlags;
+
+		// The serial of the classifier that classified PathFlags.
+		uint32 PathFlagsSerial = 0;
+
+		// The names of the modules or mount points that contain the enums.
+		TArray<FName> ModuleNames;
+
+		// The traits of the enums.
+		TArray<EEnumTraitFlags> TraitFlags;
+
+		// The number of values of the enums, or INDEX_NONE if unknown.
+		TArray<int32> NumValues;
+
+		// The search keys of the enum names, built on first use after nodes have been added or removed.
+		mutable FEnumSearchKeys SearchKeys;
+
+		// Whether the search keys need to be rebuilt.
+		mutable bool bSearchKeysDirty = true;
+
+		// The trigram index of the enum names, which is only built for large registries.
+		TUniquePtr<FEnumTrigramIndex> TrigramIndex;
+
+		// The alphabetical order of the nodes, into which added nodes are merged on first use.
+		mutable FEnumSortOrder SortOrder;
+
+		// The number that identifies the current set of nodes.
+		uint32 Generation = 0;
+
+		// The map of enum paths to indexes in EnumNodes, used for deduplication and lookup.
+		TMap<FName, int32> EnumNodeIndices;
+
+		// The map of package names to the enum paths contained in that package.
+		TMultiMap<FName, FName> EnumPathsByPackage;
+	};
+
+	using FEnumRegistrySnapshotPtr = TSharedPtr<FEnumRegistrySnapshot, ESPMode::ThreadSafe>;
+}
@@ -0,0 +1,169 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumSearchKeys.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#endif
+
+namespace EnumViewer
+{
+	namespace EnumSearchKeysInternal
+	{
+		// Converts an ASCII character to upper case.
+		static ANSICHAR ToUpperAscii(const TCHAR InChar)
+		{
+			return static_cast<ANSICHAR>((InChar >= TEXT('a') && InChar <= TEXT('z')) ? (InChar - TEXT('a') + TEXT('A')) : InChar);
+		}
+
+		// Returns whether the string consists of non-null ASCII characters.
+		static bool IsAscii(const FString& InString)
+		{
+			for (const TCHAR Char : InString)
+			{
+				if (Char == TEXT('\0') || Char > 0x7F)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	void FEnumSearchKeys::Build(const TArray<FName>& InEnumNames)
+	{
+		const int32 NumKeys = InEnumNames.Num();
+		Buffer.Reset();
+		KeyOffsets.Reset(NumKeys + 1);
+		UnsupportedKeys.Init(false, NumKeys);
+
+		FString EnumNameString;
+		for (int32 Index = 0; Index < NumKeys; Index++)
+		{
+			KeyOffsets.Add(Buffer.Num());
+
+			InEnumNames[Index].ToString(EnumNameString);
+			if (EnumSearchKeysInternal::IsAscii(EnumNameString))
+			{
+				for (const TCHAR Char : EnumNameString)
+				{
+					Buffer.Add(EnumSearchKeysInternal::ToUpperAscii(Char));
+				}
+			}
+			else
+			{
+				UnsupportedKeys[Index] = true;
+			}
+
+			// The separator never matches a term, so a match can't span two keys.
+			Buffer.Add('\0');
+		}
+		KeyOffsets.Add(Buffer.Num());
+	}
+
+	int32 FEnumSearchKeys::Num() const
+	{
+		return UnsupportedKeys.Num();
+	}
+
+	SIZE_T FEnumSearchKeys::GetAllocatedSize() const
+	{
+		return (
+			Buffer.GetAllocatedSize() +
+			KeyOffsets.GetAllocatedSize() +
+			UnsupportedKeys.GetAllocatedSize()
+		);
+	}
+
+	bool FEnumSearchKeys::IsSupportedTerm(const FString& InTerm)
+	{
+		return EnumSearchKeysInternal::IsAscii(InTerm);
+	}
+
+	void FEnumSearchKeys::FindSubstring(const FString& InTerm, TBitArray<>& OutMatches) const
+	{
+		check(IsSupportedTerm(InTerm));
+
+		const int32 NumKeys = Num();
+		OutMatches.Init(false, NumKeys);
+
+		const int32 TermLen = InTerm.Len();
+		if (TermLen == 0)
+		{
+			for (int32 Index = 0; Index < NumKeys; Index++)
+			{
+				OutMatches[Index] = !UnsupportedKeys[Index];
+			}
+			return;
+		}
+
+		TArray<ANSICHAR, TInlineAllocator<64>> Term;
+		Term.Reserve(TermLen);
+		for (const TCHAR Char : InTerm)
+		{
+			Term.Add(EnumSearchKeysInternal::ToUpperAscii(Char));
+		}
+
+		const ANSICHAR* Data = Buffer.GetData();
+		const int32 DataLen = Buffer.Num();
+		const int32 LastStart = (DataLen - TermLen);
+
+		// Since the candidates are visited in increasing order, the key containing each match is found by moving forward.
+		int32 KeyIndex = 0;
+		int32 SkipUntil = 0;
+		auto TestCandidate = [&](const int32 Candidate)
+		{
+			if (Candidate < SkipUntil || FMemory::Memcmp(Data + Candidate, Term.GetData(), TermLen) != 0)
+			{
+				return;
+			}
+
+			while (KeyOffsets[KeyIndex + 1] <= Candidate)
+			{
+				KeyIndex++;
+			}
+			OutMatches[KeyIndex] = true;
+
+			// One match is enough for each key.
+			SkipUntil = KeyOffsets[KeyIndex + 1];
+		};
+
+		int32 Position = 0;
+
+#if PLATFORM_CPU_X86_FAMILY
+		// Compare 16 positions at once against the first and last characters of the term,
+		// and only test the positions where both match.
+		const __m128i FirstChar = _mm_set1_epi8(Term[0]);
+		const __m128i LastChar = _mm_set1_epi8(Term[TermLen - 1]);
+		while (Position + TermLen - 1 + 16 <= DataLen)
+		{
+			const __m128i FirstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Position));
+			const __m128i LastBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Position + TermLen - 1));
+			uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(
+				_mm_and_si128(_mm_cmpeq_epi8(FirstBlock, FirstChar), _mm_cmpeq_epi8(LastBlock, LastChar))
+			));
+			while (Mask != 0)
+			{
+				TestCandidate(Position + static_cast<int32>(FMath::CountTrailingZeros(Mask)));
+				Mask &= (Mask - 1);
+			}
+
+			Position = FMath::Max(Position + 16, SkipUntil);
+		}
+#endif
+
+		for (; Position <= LastStart; Position++)
+		{
+			if (Data[Position] == Term[0])
+			{
+				TestCandidate(Position);
+			}
+		}
+	}
+
+	const TBitArray<>& FEnumSearchKeys::GetUnsupportedKeys() const
+	{
+		return UnsupportedKeys;
+	}
+}
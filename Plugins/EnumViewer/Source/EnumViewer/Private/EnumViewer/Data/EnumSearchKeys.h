@@ -0,0 +1,46 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EnumViewer
+{
+	/**
+	 * The case-folded enum names of a snapshot packed into a single buffer, ordered by registry index.
+	 * Searching for a plain term scans the whole buffer at once instead of comparing the names one by one.
+	 */
+	class FEnumSearchKeys
+	{
+	public:
+		// Builds the search keys from the enum names indexed by registry index.
+		void Build(const TArray<FName>& InEnumNames);
+
+		// Returns the number of search keys.
+		int32 Num() const;
+
+		// Returns the approximate amount of memory allocated by the search keys.
+		SIZE_T GetAllocatedSize() const;
+
+		// Returns whether the term can be searched for with FindSubstring.
+		// Only terms consisting of ASCII characters are supported.
+		static bool IsSupportedTerm(const FString& InTerm);
+
+		// Marks the keys that contain the term, ignoring case.
+		// Keys that could not be case-folded are never marked and must be tested with GetUnsupportedKeys.
+		void FindSubstring(const FString& InTerm, TBitArray<>& OutMatches) const;
+
+		// Returns the keys whose names contain characters other than ASCII, which are not stored in the buffer.
+		const TBitArray<>& GetUnsupportedKeys() const;
+
+	private:
+		// The upper case names separated by null characters.
+		TArray<ANSICHAR> Buffer;
+
+		// The offsets of the keys in the buffer, followed by the size of the buffer.
+		TArray<int32> KeyOffsets;
+
+		// The keys whose names contain characters other than ASCII.
+		TBitArray<> UnsupportedKeys;
+	};
+}
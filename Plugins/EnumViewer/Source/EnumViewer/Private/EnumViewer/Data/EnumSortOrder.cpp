@@ -0,0 +1,287 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumSortOrder.h"
+#include "Algo/BinarySearch.h"
+
+namespace EnumViewer
+{
+	namespace EnumSortOrderInternal
+	{
+		// The number of bits used for each character packed into a sort key.
+		static constexpr int32 BitsPerChar = 6;
+
+		// The number of characters packed into a sort key.
+		static constexpr int32 NumCharsInSortKey = 10;
+
+		// The number of bits of the sort keys sorted by each pass of the radix sort, and the mask for them.
+		static constexpr int32 RadixBits = 8;
+		static constexpr uint64 RadixMask = (1ull << RadixBits) - 1;
+
+		// Returns the code of the character in the sort key, which keeps the order of the lower case characters.
+		// The characters used in identifiers have codes of their own, and the others share the code of the range they fall into.
+		// The codes 0 (end of the name) and the shared ones are followed by nothing, as the names can't be told apart from them.
+		static uint64 GetCharCode(const TCHAR InChar, bool& bOutIsLastChar)
+		{
+			const TCHAR Char = FChar::ToLower(InChar);
+			bOutIsLastChar = false;
+			if (Char >= TEXT('0') && Char <= TEXT('9'))
+			{
+				return 2 + (Char - TEXT('0'));
+			}
+			if (Char == TEXT('_'))
+			{
+				return 13;
+			}
+			if (Char >= TEXT('a') && Char <= TEXT('z'))
+			{
+				return 15 + (Char - TEXT('a'));
+			}
+
+			bOutIsLastChar = true;
+			if (Char < TEXT('0'))
+			{
+				return 1;
+			}
+			if (Char < TEXT('_'))
+			{
+				return 12;
+			}
+			if (Char < TEXT('a'))
+			{
+				return 14;
+			}
+			return 41;
+		}
+	}
+
+	void FEnumSortOrder::Build(const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths)
+	{
+		const int32 NumNodes = InEnumNames.Num();
+		SortKeys.Reset(NumNodes);
+		SortedNodeIndices.Reset(NumNodes);
+		AddedNodeIndices.Reset();
+		for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+		{
+			SortKeys.Add(MakeSortKey(InEnumNames[NodeIndex].ToString()));
+			SortedNodeIndices.Add(NodeIndex);
+		}
+
+		SortedNodeIndices.Sort(
+			[&](const int32 Lhs, const int32 Rhs) -> bool
+			{
+				return IsBefore(Lhs, Rhs, InEnumNames, InEnumPaths);
+			}
+		);
+	}
+
+	void FEnumSortOrder::AddNode(const int32 InNodeIndex, const FName& InEnumName)
+	{
+		check(InNodeIndex == SortKeys.Num());
+		SortKeys.Add(MakeSortKey(InEnumName.ToString()));
+		AddedNodeIndices.Add(InNodeIndex);
+	}
+
+	void FEnumSortOrder::RemoveNode(const int32 InNodeIndex, const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths)
+	{
+		// Both the removed node and the moved one are looked up by binary search, so they must be in the order.
+		if (AddedNodeIndices.Num() > 0)
+		{
+			MergeAddedNodes(InEnumNames, InEnumPaths);
+		}
+
+		auto IsBeforePredicate = [&](const int32 Lhs, const int32 Rhs) -> bool
+		{
+			return IsBefore(Lhs, Rhs, InEnumNames, InEnumPaths);
+		};
+
+		const int32 RemovedPosition = Algo::LowerBound(SortedNodeIndices, InNodeIndex, IsBeforePredicate);
+		check(SortedNodeIndices.IsValidIndex(RemovedPosition) && SortedNodeIndices[RemovedPosition] == InNodeIndex);
+		SortedNodeIndices.RemoveAt(RemovedPosition, 1, false);
+
+		// The last node keeps its place in the order and only changes its registry index.
+		const int32 LastNodeIndex = SortKeys.Num() - 1;
+		if (InNodeIndex != LastNodeIndex)
+		{
+			const int32 MovedPosition = Algo::LowerBound(SortedNodeIndices, LastNodeIndex, IsBeforePredicate);
+			check(SortedNodeIndices.IsValidIndex(MovedPosition) && SortedNodeIndices[MovedPosition] == LastNodeIndex);
+			SortedNodeIndices[MovedPosition] = InNodeIndex;
+		}
+		SortKeys.RemoveAtSwap(InNodeIndex, 1, false);
+	}
+
+	void FEnumSortOrder::RemoveNodes(const TArray<int32>& InNewNodeIndices)
+	{
+		check(InNewNodeIndices.Num() == SortKeys.Num());
+
+		int32 NumRemainingNodes = 0;
+		for (int32 NodeIndex = 0; NodeIndex < InNewNodeIndices.Num(); NodeIndex++)
+		{
+			const int32 NewNodeIndex = InNewNodeIndices[NodeIndex];
+			if (NewNodeIndex != INDEX_NONE)
+			{
+				SortKeys[NewNodeIndex] = SortKeys[NodeIndex];
+				NumRemainingNodes++;
+			}
+		}
+		SortKeys.SetNum(NumRemainingNodes, false);
+
+		// Renumbering keeps the order, as the remaining nodes keep their names.
+		auto RenumberNodeIndices = [&InNewNodeIndices](TArray<int32>& InOutNodeIndices)
+		{
+			int32 WriteIndex = 0;
+			for (const int32 NodeIndex : InOutNodeIndices)
+			{
+				const int32 NewNodeIndex = InNewNodeIndices[NodeIndex];
+				if (NewNodeIndex != INDEX_NONE)
+				{
+					InOutNodeIndices[WriteIndex++] = NewNodeIndex;
+				}
+			}
+			InOutNodeIndices.SetNum(WriteIndex, false);
+		};
+		RenumberNodeIndices(SortedNodeIndices);
+		RenumberNodeIndices(AddedNodeIndices);
+	}
+
+	const TArray<int32>& FEnumSortOrder::GetSortedNodeIndices(const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths)
+	{
+		if (AddedNodeIndices.Num() > 0)
+		{
+			MergeAddedNodes(InEnumNames, InEnumPaths);
+		}
+
+		return SortedNodeIndices;
+	}
+
+	SIZE_T FEnumSortOrder::GetAllocatedSize() const
+	{
+		return (
+			SortKeys.GetAllocatedSize() +
+			SortedNodeIndices.GetAllocatedSize() +
+			AddedNodeIndices.GetAllocatedSize()
+		);
+	}
+
+	uint64 FEnumSortOrder::MakeSortKey(const FString& InString)
+	{
+		using namespace EnumSortOrderInternal;
+
+		// The first character goes into the most significant bits, so that the keys compare like the strings.
+		uint64 SortKey = 0;
+		for (int32 Index = 0; Index < NumCharsInSortKey && Index < InString.Len(); Index++)
+		{
+			bool bIsLastChar = false;
+			SortKey |= GetCharCode(InString[Index], bIsLastChar) << (BitsPerChar * (NumCharsInSortKey - 1 - Index));
+			if (bIsLastChar)
+			{
+				break;
+			}
+		}
+
+		return SortKey;
+	}
+
+	void FEnumSortOrder::SortByKeys(TArray<int32>& InOutNodeIndices, const TArray<uint64>& InSortKeys)
+	{
+		using namespace EnumSortOrderInternal;
+
+		// Only the bytes that differ between some of the keys need a pass.
+		uint64 AnyBits = 0;
+		uint64 AllBits = ~0ull;
+		for (const int32 NodeIndex : InOutNodeIndices)
+		{
+			AnyBits |= InSortKeys[NodeIndex];
+			AllBits &= InSortKeys[NodeIndex];
+		}
+		const uint64 VaryingBits = (AnyBits ^ AllBits);
+
+		// Sort by each byte from the least significant one, distributing the nodes into buckets in their current order.
+		TArray<int32> SortedNodeIndices;
+		SortedNodeIndices.SetNumUninitialized(InOutNodeIndices.Num());
+		for (int32 Shift = 0; Shift < 64; Shift += RadixBits)
+		{
+			if (((VaryingBits >> Shift) & RadixMask) == 0)
+			{
+				continue;
+			}
+
+			int32 BucketStarts[RadixMask + 1] = {};
+			for (const int32 NodeIndex : InOutNodeIndices)
+			{
+				BucketStarts[(InSortKeys[NodeIndex] >> Shift) & RadixMask]++;
+			}
+
+			int32 NextStart = 0;
+			for (int32& BucketStart : BucketStarts)
+			{
+				const int32 BucketSize = BucketStart;
+				BucketStart = NextStart;
+				NextStart += BucketSize;
+			}
+
+			for (const int32 NodeIndex : InOutNodeIndices)
+			{
+				SortedNodeIndices[BucketStarts[(InSortKeys[NodeIndex] >> Shift) & RadixMask]++] = NodeIndex;
+			}
+			Swap(InOutNodeIndices, SortedNodeIndices);
+		}
+	}
+
+	bool FEnumSortOrder::IsBefore(const int32 InLhs, const int32 InRhs, const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths) const
+	{
+		if (SortKeys[InLhs] != SortKeys[InRhs])
+		{
+			return (SortKeys[InLhs] < SortKeys[InRhs]);
+		}
+
+		// Only names that share the packed prefix are compared as strings.
+		if (InEnumNames[InLhs] != InEnumNames[InRhs])
+		{
+			const int32 Result = FCString::Stricmp(*InEnumNames[InLhs].ToString(), *InEnumNames[InRhs].ToString());
+			if (Result != 0)
+			{
+				return (Result < 0);
+			}
+		}
+
+		return (InEnumPaths[InLhs].Compare(InEnumPaths[InRhs]) < 0);
+	}
+
+	void FEnumSortOrder::MergeAddedNodes(const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths)
+	{
+		auto IsBeforePredicate = [&](const int32 Lhs, const int32 Rhs) -> bool
+		{
+			return IsBefore(Lhs, Rhs, InEnumNames, InEnumPaths);
+		};
+
+		// Sorting only the added nodes and merging them is linear in the number of existing nodes,
+		// rather than inserting each of them or sorting everything again.
+		AddedNodeIndices.Sort(IsBeforePredicate);
+		if (SortedNodeIndices.Num() == 0)
+		{
+			Swap(SortedNodeIndices, AddedNodeIndices);
+			return;
+		}
+
+		TArray<int32> MergedNodeIndices;
+		MergedNodeIndices.Reserve(SortedNodeIndices.Num() + AddedNodeIndices.Num());
+		int32 SortedIndex = 0;
+		int32 AddedIndex = 0;
+		while (SortedIndex < SortedNodeIndices.Num() && AddedIndex < AddedNodeIndices.Num())
+		{
+			if (IsBeforePredicate(AddedNodeIndices[AddedIndex], SortedNodeIndices[SortedIndex]))
+			{
+				MergedNodeIndices.Add(AddedNodeIndices[AddedIndex++]);
+			}
+			else
+			{
+				MergedNodeIndices.Add(SortedNodeIndices[SortedIndex++]);
+			}
+		}
+		MergedNodeIndices.Append(SortedNodeIndices.GetData() + SortedIndex, SortedNodeIndices.Num() - SortedIndex);
+		MergedNodeIndices.Append(AddedNodeIndices.GetData() + AddedIndex, AddedNodeIndices.Num() - AddedIndex);
+
+		SortedNodeIndices = MoveTemp(MergedNodeIndices);
+		AddedNodeIndices.Reset();
+	}
+}
@@ -0,0 +1,64 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EnumViewer
+{
+	/**
+	 * The registry indices of the nodes sorted alphabetically by enum name, ignoring case.
+	 * Each node has a sort key that packs the first characters of its name into an integer,
+	 * so most comparisons don't have to look at the names at all.
+	 * Added nodes are merged into the order the next time it's read, and removed nodes are taken out of it immediately.
+	 */
+	class FEnumSortOrder
+	{
+	public:
+		// Rebuilds the order from the enum names and paths indexed by registry index.
+		void Build(const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths);
+
+		// Adds the node at the specified registry index, which must be the next one.
+		void AddNode(const int32 InNodeIndex, const FName& InEnumName);
+
+		// Removes the node at the specified registry index, and moves the last node into its slot as the snapshot does.
+		// This must be called before the columns of the snapshot are updated.
+		void RemoveNode(const int32 InNodeIndex, const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths);
+
+		// Removes the nodes whose new registry index is INDEX_NONE and renumbers the others.
+		// The new registry indices must keep the order of the old ones.
+		void RemoveNodes(const TArray<int32>& InNewNodeIndices);
+
+		// Returns the registry indices of all the nodes in alphabetical order, merging the added nodes first.
+		const TArray<int32>& GetSortedNodeIndices(const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths);
+
+		// Returns the approximate amount of memory allocated by the order.
+		SIZE_T GetAllocatedSize() const;
+
+		// Returns a sort key that packs the first characters of the string, case-folded.
+		// Strings with different keys compare like their keys, and strings with the same key must be compared as strings.
+		static uint64 MakeSortKey(const FString& InString);
+
+		// Sorts the registry indices by the sort keys indexed by registry index, smallest first.
+		// The sort is stable, so the nodes with the same key keep their order.
+		static void SortByKeys(TArray<int32>& InOutNodeIndices, const TArray<uint64>& InSortKeys);
+
+	private:
+		// Returns whether the node at the first registry index comes before the node at the second one.
+		// Nodes with the same name are ordered by enum path so that the order is always the same.
+		bool IsBefore(const int32 InLhs, const int32 InRhs, const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths) const;
+
+		// Sorts the added nodes and merges them into the order.
+		void MergeAddedNodes(const TArray<FName>& InEnumNames, const TArray<FName>& InEnumPaths);
+
+	private:
+		// The sort keys of the nodes, indexed by registry index.
+		TArray<uint64> SortKeys;
+
+		// The registry indices of the nodes in alphabetical order, excluding the added nodes that have not been merged yet.
+		TArray<int32> SortedNodeIndices;
+
+		// The registry indices of the nodes added since the last merge.
+		TArray<int32> AddedNodeIndices;
+	};
+}
@@ -0,0 +1,223 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumTrigramIndex.h"
+#include "Algo/BinarySearch.h"
+
+namespace EnumViewer
+{
+	namespace EnumTrigramIndexInternal
+	{
+		// The number of characters in a trigram.
+		static constexpr int32 TrigramLength = 3;
+
+		// Adds the registry index to the list, keeping it sorted.
+		// Nodes are usually added at the end of the registry, so this is mostly an append.
+		static void AddSorted(TArray<int32>& NodeIndices, const int32 InNodeIndex)
+		{
+			if (NodeIndices.Num() == 0 || NodeIndices.Last() < InNodeIndex)
+			{
+				NodeIndices.Add(InNodeIndex);
+			}
+			else
+			{
+				NodeIndices.Insert(InNodeIndex, Algo::LowerBound(NodeIndices, InNodeIndex));
+			}
+		}
+
+		// Removes the registry index from the sorted list, finding it by binary search.
+		static bool RemoveSorted(TArray<int32>& NodeIndices, const int32 InNodeIndex)
+		{
+			const int32 FoundIndex = Algo::BinarySearch(NodeIndices, InNodeIndex);
+			if (FoundIndex == INDEX_NONE)
+			{
+				return false;
+			}
+
+			NodeIndices.RemoveAt(FoundIndex, 1, false);
+			return true;
+		}
+	}
+
+	void FEnumTrigramIndex::Build(const TArray<FName>& InEnumNames)
+	{
+		Postings.Reset();
+		UnindexedNodes.Reset();
+
+		for (int32 Index = 0; Index < InEnumNames.Num(); Index++)
+		{
+			AddNode(Index, InEnumNames[Index]);
+		}
+	}
+
+	void FEnumTrigramIndex::AddNode(const int32 InNodeIndex, const FName& InEnumName)
+	{
+		TArray<uint32, TInlineAllocator<64>> Trigrams;
+		if (!GetTrigrams(InEnumName.ToString(), Trigrams))
+		{
+			EnumTrigramIndexInternal::AddSorted(UnindexedNodes, InNodeIndex);
+			return;
+		}
+
+		for (const uint32 Trigram : Trigrams)
+		{
+			EnumTrigramIndexInternal::AddSorted(Postings.FindOrAdd(Trigram), InNodeIndex);
+		}
+	}
+
+	void FEnumTrigramIndex::RemoveNode(const int32 InNodeIndex, const FName& InEnumName)
+	{
+		TArray<uint32, TInlineAllocator<64>> Trigrams;
+		if (!GetTrigrams(InEnumName.ToString(), Trigrams))
+		{
+			EnumTrigramIndexInternal::RemoveSorted(UnindexedNodes, InNodeIndex);
+			return;
+		}
+
+		for (const uint32 Trigram : Trigrams)
+		{
+			if (TArray<int32>* NodeIndices = Postings.Find(Trigram))
+			{
+				EnumTrigramIndexInternal::RemoveSorted(*NodeIndices, InNodeIndex);
+				if (NodeIndices->Num() == 0)
+				{
+					Postings.Remove(Trigram);
+				}
+			}
+		}
+	}
+
+	void FEnumTrigramIndex::MoveNode(const int32 InOldNodeIndex, const int32 InNewNodeIndex, const FName& InEnumName)
+	{
+		// The moved node is usually the last one in the registry, so it's found at the end of each list.
+		auto ReplaceNodeIndex = [InOldNodeIndex, InNewNodeIndex](TArray<int32>& NodeIndices)
+		{
+			if (ensure(EnumTrigramIndexInternal::RemoveSorted(NodeIndices, InOldNodeIndex)))
+			{
+				EnumTrigramIndexInternal::AddSorted(NodeIndices, InNewNodeIndex);
+			}
+		};
+
+		TArray<uint32, TInlineAllocator<64>> Trigrams;
+		if (!GetTrigrams(InEnumName.ToString(), Trigrams))
+		{
+			ReplaceNodeIndex(UnindexedNodes);
+			return;
+		}
+
+		for (const uint32 Trigram : Trigrams)
+		{
+			if (TArray<int32>* NodeIndices = Postings.Find(Trigram))
+			{
+				ReplaceNodeIndex(*NodeIndices);
+			}
+		}
+	}
+
+	bool FEnumTrigramIndex::IsSupportedTerm(const FString& InTerm)
+	{
+		TArray<uint32, TInlineAllocator<64>> Trigrams;
+		return (InTerm.Len() >= EnumTrigramIndexInternal::TrigramLength && GetTrigrams(InTerm, Trigrams));
+	}
+
+	void FEnumTrigramIndex::FindSubstring(const FString& InTerm, const TArray<FName>& InEnumNames, TBitArray<>& OutMatches) const
+	{
+		check(IsSupportedTerm(InTerm));
+
+		OutMatches.Init(false, InEnumNames.Num());
+		FString EnumNameString;
+		auto VerifyNode = [&](const int32 NodeIndex)
+		{
+			InEnumNames[NodeIndex].ToString(EnumNameString);
+			if (EnumNameString.Contains(InTerm, ESearchCase::IgnoreCase))
+			{
+				OutMatches[NodeIndex] = true;
+			}
+		};
+
+		// The index doesn't know how the names that couldn't be indexed are folded, so always verify them.
+		for (const int32 NodeIndex : UnindexedNodes)
+		{
+			VerifyNode(NodeIndex);
+		}
+
+		// A node that contains the term contains all of its trigrams.
+		TArray<uint32, TInlineAllocator<64>> Trigrams;
+		GetTrigrams(InTerm, Trigrams);
+
+		TArray<const TArray<int32>*, TInlineAllocator<64>> PostingLists;
+		for (const uint32 Trigram : Trigrams)
+		{
+			const TArray<int32>* NodeIndices = Postings.Find(Trigram);
+			if (NodeIndices == nullptr)
+			{
+				return;
+			}
+
+			PostingLists.Add(NodeIndices);
+		}
+		PostingLists.Sort(
+			[](const TArray<int32>& Lhs, const TArray<int32>& Rhs) -> bool
+			{
+				return (Lhs.Num() < Rhs.Num());
+			}
+		);
+
+		// Intersecting the two shortest lists is usually selective enough, and the rest is left to the verification.
+		if (PostingLists.Num() == 1)
+		{
+			for (const int32 NodeIndex : *PostingLists[0])
+			{
+				VerifyNode(NodeIndex);
+			}
+			return;
+		}
+
+		TBitArray<> InShortestList(false, InEnumNames.Num());
+		for (const int32 NodeIndex : *PostingLists[0])
+		{
+			InShortestList[NodeIndex] = true;
+		}
+		for (const int32 NodeIndex : *PostingLists[1])
+		{
+			if (InShortestList[NodeIndex])
+			{
+				VerifyNode(NodeIndex);
+			}
+		}
+	}
+
+	SIZE_T FEnumTrigramIndex::GetAllocatedSize() const
+	{
+		SIZE_T AllocatedSize = Postings.GetAllocatedSize() + UnindexedNodes.GetAllocatedSize();
+		for (const auto& Pair : Postings)
+		{
+			AllocatedSize += Pair.Value.GetAllocatedSize();
+		}
+
+		return AllocatedSize;
+	}
+
+	bool FEnumTrigramIndex::GetTrigrams(const FString& InString, TArray<uint32, TInlineAllocator<64>>& OutTrigrams)
+	{
+		OutTrigrams.Reset();
+
+		uint32 Trigram = 0;
+		for (int32 Index = 0; Index < InString.Len(); Index++)
+		{
+			const TCHAR Char = InString[Index];
+			if (Char > 0x7F)
+			{
+				return false;
+			}
+
+			// Pack the last three upper case characters into the lower 24 bits.
+			Trigram = ((Trigram << 8) | static_cast<uint8>(FChar::ToUpper(Char))) & 0xFFFFFF;
+			if (Index >= EnumTrigramIndexInternal::TrigramLength - 1)
+			{
+				OutTrigrams.AddUnique(Trigram);
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,49 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EnumViewer
+{
+	/**
+	 * An inverted index from the case-folded trigrams of the enum names to the registry indices of the nodes that contain them.
+	 * It's updated as nodes are added and removed, so a search only has to verify the nodes that contain all trigrams of the term.
+	 */
+	class FEnumTrigramIndex
+	{
+	public:
+		// Builds the index from the enum names indexed by registry index.
+		void Build(const TArray<FName>& InEnumNames);
+
+		// Adds the node at the specified registry index.
+		void AddNode(const int32 InNodeIndex, const FName& InEnumName);
+
+		// Removes the node at the specified registry index.
+		void RemoveNode(const int32 InNodeIndex, const FName& InEnumName);
+
+		// Updates the registry index of a node that has been moved to another slot.
+		void MoveNode(const int32 InOldNodeIndex, const int32 InNewNodeIndex, const FName& InEnumName);
+
+		// Returns whether the index can narrow down the nodes that contain the term.
+		// Terms shorter than a trigram can't be looked up.
+		static bool IsSupportedTerm(const FString& InTerm);
+
+		// Marks the nodes whose enum names contain the term, ignoring case.
+		void FindSubstring(const FString& InTerm, const TArray<FName>& InEnumNames, TBitArray<>& OutMatches) const;
+
+		// Returns the approximate amount of memory allocated by the index.
+		SIZE_T GetAllocatedSize() const;
+
+	private:
+		// Collects the distinct trigrams of the string, or returns false if it contains characters other than ASCII.
+		static bool GetTrigrams(const FString& InString, TArray<uint32, TInlineAllocator<64>>& OutTrigrams);
+
+	private:
+		// The registry indices of the nodes that contain each trigram, in ascending order so that a node can be found by binary search.
+		TMap<uint32, TArray<int32>> Postings;
+
+		// The registry indices of the nodes whose names can't be indexed, which are always verified, in ascending order.
+		TArray<int32> UnindexedNodes;
+	};
+}
@@ -0,0 +1,549 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumViewerFilterContext.h"
+#include "EnumViewer/Data/EnumRegistrySnapshot.h"
+#include "EnumViewer/Data/EnumViewerNode.h"
+#include "EnumViewer/Data/EnumSearchKeys.h"
+#include "EnumViewer/Data/EnumTrigramIndex.h"
+#include "EnumViewer/Types/EnumViewerInitializationOptions.h"
+#include "EnumViewer/Types/EnumViewerFilter.h"
+#include "EnumViewer/Utilities/EnumViewerSettings.h"
+#include "EnumViewer/EnumViewerGlobals.h"
+#include "Misc/TextFilterExpressionEvaluator.h"
+
+namespace EnumViewer
+{
+	namespace EnumViewerFilterContextInternal
+	{
+		// Returns the buffer that the name of each node is written to.
+		// Each thread has its own so that nodes can be filtered in parallel without allocating memory for each node.
+		static FString& GetEnumNameBuffer()
+		{
+			static thread_local FString EnumNameBuffer;
+			return EnumNameBuffer;
+		}
+
+		// When there are fewer candidates than the snapshot has nodes divided by this, the names of the candidates are tested one by one
+		// for a plain term, rather than scanning the names of all the nodes at once.
+		static constexpr int32 MinNodesPerCandidateToTestEach = 8;
+
+		// Returns the buffer that the string columns tested by keyed expressions are written to.
+		static FString& GetColumnBuffer()
+		{
+			static thread_local FString ColumnBuffer;
+			return ColumnBuffer;
+		}
+
+		/**
+		 * The names that can be used as values of the Type and Flags keys, and the traits they stand for.
+		 */
+		struct FTraitName
+		{
+			const TCHAR* Name;
+			EEnumTraitFlags Flags;
+		};
+		static const FTraitName TypeNames[] = {
+			{ TEXT("Native"), EEnumTraitFlags::Native },
+			{ TEXT("Asset"), EEnumTraitFlags::Asset },
+		};
+		static const FTraitName FlagNames[] = {
+			{ TEXT("Bitmask"), EEnumTraitFlags::Bitmask },
+			{ TEXT("Bitflags"), EEnumTraitFlags::Bitmask },
+			{ TEXT("EnumClass"), EEnumTraitFlags::EnumClass },
+		};
+
+		// Returns the traits named by a value such as "Asset" or "Asset|Native", or None if any of the names is unknown.
+		template<int32 NumNames>
+		static EEnumTraitFlags ParseTraitFlags(const FString& InValue, const FTraitName (&InNames)[NumNames])
+		{
+			EEnumTraitFlags Flags = EEnumTraitFlags::None;
+			int32 Start = 0;
+			while (Start <= InValue.Len())
+			{
+				int32 End = InValue.Find(TEXT("|"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+				if (End == INDEX_NONE)
+				{
+					End = InValue.Len();
+				}
+
+				const FTraitName* FoundName = nullptr;
+				for (const FTraitName& TraitName : InNames)
+				{
+					if (FCString::Strlen(TraitName.Name) == End - Start &&
+						FCString::Strnicmp(*InValue + Start, TraitName.Name, End - Start) == 0)
+					{
+						FoundName = &TraitName;
+						break;
+					}
+				}
+				if (FoundName == nullptr)
+				{
+					return EEnumTraitFlags::None;
+				}
+
+				Flags |= FoundName->Flags;
+				Start = End + 1;
+			}
+
+			return Flags;
+		}
+
+		/**
+		 * Evaluates the search query for a node of a snapshot.
+		 * Plain terms are matched against the name of the enum, and keyed expressions such as "Module:Engine" or "Values>32"
+		 * against the columns of the snapshot, so that no enum is loaded to test them.
+		 */
+		class FEnumFilterExpressionContext : public ITextFilterExpressionContext
+		{
+		public:
+			// Constructor.
+			FEnumFilterExpressionContext(const FEnumRegistrySnapshot& InSnapshot, const int32 InNodeIndex, const FString& InEnumName)
+				: Snapshot(InSnapshot)
+				, NodeIndex(InNodeIndex)
+				, EnumName(InEnumName)
+			{
+			}
+
+			// ITextFilterExpressionContext interface.
+			virtual bool TestBasicStringExpression(
+				const FTextFilterString& InValue,
+				const ETextFilterTextComparisonMode InTextComparisonMode
+			) const override
+			{
+				return TextFilterUtils::TestBasicStringExpression(EnumName, InValue, InTextComparisonMode);
+			}
+			virtual bool TestComplexExpression(
+				const FName& InKey,
+				const FTextFilterString& InValue,
+				const ETextFilterComparisonOperation InComparisonOperation,
+				const ETextFilterTextComparisonMode InTextComparisonMode
+			) const override
+			{
+				static const FName NameKey = TEXT("Name");
+				static const FName ModuleKey = TEXT("Module");
+				static const FName PathKey = TEXT("Path");
+				static const FName PackageKey = TEXT("Package");
+				static const FName TypeKey = TEXT("Type");
+				static const FName FlagsKey = TEXT("Flags");
+				static const FName ValuesKey = TEXT("Values");
+
+				if (InKey == NameKey)
+				{
+					return TextFilterUtils::TestComplexExpression(EnumName, InValue, InComparisonOperation, InTextComparisonMode);
+				}
+				if (InKey == ModuleKey)
+				{
+					return TestNameColumn(Snapshot.GetModuleNames(), InValue, InComparisonOperation, InTextComparisonMode);
+				}
+				if (InKey == PathKey)
+				{
+					return TestNameColumn(Snapshot.GetEnumPaths(), InValue, InComparisonOperation, InTextComparisonMode);
+				}
+				if (InKey == PackageKey)
+				{
+					return TestNameColumn(Snapshot.GetPackageNames(), InValue, InComparisonOperation, InTextComparisonMode);
+				}
+				if (InKey == TypeKey)
+				{
+					return TestTraitFlags(ParseTraitFlags(InValue.AsString(), TypeNames), InComparisonOperation);
+				}
+				if (InKey == FlagsKey)
+				{
+					return TestTraitFlags(ParseTraitFlags(InValue.AsString(), FlagNames), InComparisonOperation);
+				}
+				if (InKey == ValuesKey)
+				{
+					return TestNumValues(InValue, InComparisonOperation);
+				}
+
+				return false;
+			}
+			// End of ITextFilterExpressionContext interface.
+
+		private:
+			// Tests a column of names against the value of a keyed expression in the same way as the evaluator tests strings.
+			bool TestNameColumn(
+				const TArray<FName>& InColumn,
+				const FTextFilterString& InValue,
+				const ETextFilterComparisonOperation InComparisonOperation,
+				const ETextFilterTextComparisonMode InTextComparisonMode
+			) const
+			{
+				FString& ColumnBuffer = GetColumnBuffer();
+				InColumn[NodeIndex].ToString(ColumnBuffer);
+				return TextFilterUtils::TestComplexExpression(ColumnBuffer, InValue, InComparisonOperation, InTextComparisonMode);
+			}
+
+			// Tests whether the enum has any of the traits, or none of them for "!=".
+			bool TestTraitFlags(const EEnumTraitFlags InFlags, const ETextFilterComparisonOperation InComparisonOperation) const
+			{
+				if (InFlags == EEnumTraitFlags::None)
+				{
+					return false;
+				}
+
+				const bool bHasAnyFlags = EnumHasAnyFlags(Snapshot.GetTraitFlags()[NodeIndex], InFlags);
+				switch (InComparisonOperation)
+				{
+				case ETextFilterComparisonOperation::Equal:
+					return bHasAnyFlags;
+				case ETextFilterComparisonOperation::NotEqual:
+					return !bHasAnyFlags;
+				default:
+					return false;
+				}
+			}
+
+			// Compares the number of values of the enum with the value of a keyed expression.
+			// Enums whose number of values is unknown never match.
+			bool TestNumValues(const FTextFilterString& InValue, const ETextFilterComparisonOperation InComparisonOperation) const
+			{
+				const int32 NumValues = Snapshot.GetNumValues()[NodeIndex];
+				const FString& ValueString = InValue.AsString();
+				if (NumValues == INDEX_NONE || !ValueString.IsNumeric())
+				{
+					return false;
+				}
+
+				const int32 Value = FCString::Atoi(*ValueString);
+				switch (InComparisonOperation)
+				{
+				case ETextFilterComparisonOperation::Equal:
+					return (NumValues == Value);
+				case ETextFilterComparisonOperation::NotEqual:
+					return (NumValues != Value);
+				case ETextFilterComparisonOperation::Less:
+					return (NumValues < Value);
+				case ETextFilterComparisonOperation::LessOrEqual:
+					return (NumValues <= Value);
+				case ETextFilterComparisonOperation::Greater:
+					return (NumValues > Value);
+				case ETextFilterComparisonOperation::GreaterOrEqual:
+					return (NumValues >= Value);
+				default:
+					return false;
+				}
+			}
+
+		private:
+			// The snapshot that contains the node.
+			const FEnumRegistrySnapshot& Snapshot;
+
+			// The registry index of the node.
+			int32 NodeIndex;
+
+			// The name of the enum of the node.
+			const FString& EnumName;
+		};
+	}
+
+	FEnumViewerFilterContext::FEnumViewerFilterContext(
+		const FEnumRegistrySnapshot& InSnapshot,
+		const FEnumViewerInitializationOptions& InInitOptions,
+		const EEnumViewerDeveloperType InDeveloperType,
+		const bool bInShowInternalEnums,
+		const TSharedPtr<FTextFilterExpressionEvaluator>& InTextFilter
+	)
+		: Snapshot(InSnapshot)
+		, InitOptions(InInitOptions)
+		, DeveloperType(InDeveloperType)
+		, bShowInternalEnums(bInShowInternalEnums)
+		, TextFilter(nullptr)
+		, bHasSearchKeyMatches(false)
+		, UnsupportedSearchKeys(nullptr)
+	{
+		// An empty search matches everything, so skip testing it for each node.
+		if (InTextFilter.IsValid() && !InTextFilter->GetFilterText().IsEmpty())
+		{
+			TextFilter = InTextFilter.Get();
+
+			// Neither the trigram index nor the search keys can find subsequences, so fuzzy search tests each name.
+			// Other plain terms are matched by MatchPlainTerm once the candidates are known.
+			const FString FilterText = TextFilter->GetFilterText().ToString();
+			if (IsPlainTerm(FilterText))
+			{
+				if (InitOptions.SearchMode == EEnumViewerSearchMode::Fuzzy)
+				{
+					FuzzyMatcher.Emplace(FilterText);
+				}
+				else
+				{
+					PlainTerm = FilterText;
+				}
+			}
+		}
+	}
+
+	void FEnumViewerFilterContext::MatchPlainTerm(TArrayView<const int32> InCandidateIndices)
+	{
+		if (PlainTerm.IsEmpty() || InCandidateIndices.Num() == 0)
+		{
+			return;
+		}
+
+		// A few candidates, such as when a query extends a cached one, are cheaper to test than all the nodes.
+		const int32 NumNodes = Snapshot.Num();
+		if (InCandidateIndices.Num() * EnumViewerFilterContextInternal::MinNodesPerCandidateToTestEach <= NumNodes)
+		{
+			SearchKeyMatches.Init(false, NumNodes);
+			FString& EnumNameBuffer = EnumViewerFilterContextInternal::GetEnumNameBuffer();
+			for (const int32 NodeIndex : InCandidateIndices)
+			{
+				Snapshot.GetEnumNames()[NodeIndex].ToString(EnumNameBuffer);
+				SearchKeyMatches[NodeIndex] = EnumNameBuffer.Contains(PlainTerm, ESearchCase::IgnoreCase);
+			}
+			bHasSearchKeyMatches = true;
+			return;
+		}
+
+		// If the snapshot has a trigram index, only the nodes that contain all trigrams of the term are verified.
+		// Otherwise, the term is matched against all the search keys at once, rather than evaluating the expression for each node.
+		const FEnumTrigramIndex* TrigramIndex = Snapshot.GetTrigramIndex();
+		if (TrigramIndex != nullptr && FEnumTrigramIndex::IsSupportedTerm(PlainTerm))
+		{
+			TrigramIndex->FindSubstring(PlainTerm, Snapshot.GetEnumNames(), SearchKeyMatches);
+			bHasSearchKeyMatches = true;
+		}
+		else if (FEnumSearchKeys::IsSupportedTerm(PlainTerm))
+		{
+			const FEnumSearchKeys& SearchKeys = Snapshot.GetSearchKeys();
+			SearchKeys.FindSubstring(PlainTerm, SearchKeyMatches);
+			UnsupportedSearchKeys = &SearchKeys.GetUnsupportedKeys();
+			bHasSearchKeyMatches = true;
+		}
+	}
+
+	void FEnumViewerFilterContext::FilterNodeIndices(TArrayView<const int32> InNodeIndices, TArray<int32>& OutNodeIndices) const
+	{
+		const UEnum* Enum = nullptr;
+		const TSharedPtr<IEnumViewerFilter>& EnumFilter = InitOptions.EnumFilter;
+		if (!EnumFilter.IsValid())
+		{
+			for (const int32 NodeIndex : InNodeIndices)
+			{
+				if (PassesBuiltInFilters(NodeIndex, Enum))
+				{
+					OutNodeIndices.Add(NodeIndex);
+				}
+			}
+			return;
+		}
+
+		// Split the nodes that pass the built-in filters into loaded and unloaded ones,
+		// so that the filter of the init options is called once for each kind rather than once for each node.
+		TArray<int32> PassedNodeIndices;
+		TBitArray<> IsLoaded;
+		TArray<const UEnum*> LoadedEnums;
+		TArray<FName> UnloadedEnumPaths;
+		for (const int32 NodeIndex : InNodeIndices)
+		{
+			if (!PassesBuiltInFilters(NodeIndex, Enum))
+			{
+				continue;
+			}
+
+			PassedNodeIndices.Add(NodeIndex);
+			IsLoaded.Add(Enum != nullptr);
+			if (Enum != nullptr)
+			{
+				LoadedEnums.Add(Enum);
+			}
+			else
+			{
+				UnloadedEnumPaths.Add(Snapshot.GetEnumPaths()[NodeIndex]);
+			}
+		}
+
+		TBitArray<> AllowedLoadedEnums;
+		if (LoadedEnums.Num() > 0)
+		{
+			EnumFilter->AreEnumsAllowed(InitOptions, LoadedEnums, AllowedLoadedEnums);
+			check(AllowedLoadedEnums.Num() == LoadedEnums.Num());
+		}
+
+		TBitArray<> AllowedUnloadedEnums;
+		if (UnloadedEnumPaths.Num() > 0)
+		{
+			EnumFilter->AreUnloadedEnumsAllowed(InitOptions, UnloadedEnumPaths, AllowedUnloadedEnums);
+			check(AllowedUnloadedEnums.Num() == UnloadedEnumPaths.Num());
+		}
+
+		// Merge the results back in the order of the nodes.
+		int32 LoadedIndex = 0;
+		int32 UnloadedIndex = 0;
+		for (int32 Index = 0; Index < PassedNodeIndices.Num(); Index++)
+		{
+			const bool bIsAllowed = (IsLoaded[Index] ? AllowedLoadedEnums[LoadedIndex++] : AllowedUnloadedEnums[UnloadedIndex++]);
+			if (bIsAllowed)
+			{
+				OutNodeIndices.Add(PassedNodeIndices[Index]);
+			}
+		}
+	}
+
+	bool FEnumViewerFilterContext::IsThreadSafe() const
+	{
+		// Only the columns of the snapshot are safe to read from other threads.
+		// Resolving the enums of the nodes and evaluating the search expression are left to the game thread.
+		return (!NeedsEnum() && !NeedsTextFilterEvaluator());
+	}
+
+	bool FEnumViewerFilterContext::NeedsEnum() const
+	{
+		return (!InitOptions.bShowUnloadedEnums || InitOptions.EnumFilter.IsValid());
+	}
+
+	bool FEnumViewerFilterContext::NeedsTextFilterEvaluator() const
+	{
+		if (TextFilter == nullptr || FuzzyMatcher.IsSet())
+		{
+			return false;
+		}
+
+		return (!bHasSearchKeyMatches || (UnsupportedSearchKeys != nullptr && UnsupportedSearchKeys->Find(true) != INDEX_NONE));
+	}
+
+	bool FEnumViewerFilterContext::IsRankingByScore() const
+	{
+		return FuzzyMatcher.IsSet();
+	}
+
+	void FEnumViewerFilterContext::RankNodeIndices(TArray<int32>& InOutNodeIndices) const
+	{
+		check(FuzzyMatcher.IsSet());
+
+		const int32 NumToRank = FMath::Min(InitOptions.NumRankedSearchResults, InOutNodeIndices.Num());
+		if (NumToRank <= 0)
+		{
+			return;
+		}
+
+		struct FRankedNode
+		{
+			int32 Score;
+			int32 Position;
+		};
+
+		// Ties are broken by the original order, so that equally good matches stay alphabetical.
+		auto IsBetter = [](const FRankedNode& Lhs, const FRankedNode& Rhs) -> bool
+		{
+			return (Lhs.Score != Rhs.Score ? Lhs.Score > Rhs.Score : Lhs.Position < Rhs.Position);
+		};
+		auto IsWorse = [&IsBetter](const FRankedNode& Lhs, const FRankedNode& Rhs) -> bool
+		{
+			return IsBetter(Rhs, Lhs);
+		};
+
+		// Keep the best nodes found so far in a heap with the worst of them on top,
+		// so that only those are sorted rather than all the nodes.
+		TArray<FRankedNode> BestNodes;
+		BestNodes.Reserve(NumToRank);
+		FString& EnumNameBuffer = EnumViewerFilterContextInternal::GetEnumNameBuffer();
+		for (int32 Position = 0; Position < InOutNodeIndices.Num(); Position++)
+		{
+			Snapshot.GetEnumNames()[InOutNodeIndices[Position]].ToString(EnumNameBuffer);
+			const FRankedNode RankedNode { FuzzyMatcher->Score(EnumNameBuffer), Position };
+			if (BestNodes.Num() < NumToRank)
+			{
+				BestNodes.HeapPush(RankedNode, IsWorse);
+			}
+			else if (IsBetter(RankedNode, BestNodes.HeapTop()))
+			{
+				BestNodes.HeapPopDiscard(IsWorse, false);
+				BestNodes.HeapPush(RankedNode, IsWorse);
+			}
+		}
+		BestNodes.Sort(IsBetter);
+
+		TBitArray<> IsRanked(false, InOutNodeIndices.Num());
+		TArray<int32> RankedNodeIndices;
+		RankedNodeIndices.Reserve(InOutNodeIndices.Num());
+		for (const FRankedNode& RankedNode : BestNodes)
+		{
+			RankedNodeIndices.Add(InOutNodeIndices[RankedNode.Position]);
+			IsRanked[RankedNode.Position] = true;
+		}
+		for (int32 Position = 0; Position < InOutNodeIndices.Num(); Position++)
+		{
+			if (!IsRanked[Position])
+			{
+				RankedNodeIndices.Add(InOutNodeIndices[Position]);
+			}
+		}
+
+		InOutNodeIndices = MoveTemp(RankedNodeIndices);
+	}
+
+	bool FEnumViewerFilterContext::PassesBuiltInFilters(const int32 InNodeIndex, const UEnum*& OutEnum) const
+	{
+		// The path filters only need the classification cached for the node.
+		const EEnumPathFlags PathFlags = Snapshot.GetPathFlags()[InNodeIndex];
+		check(EnumHasAnyFlags(PathFlags, EEnumPathFlags::Classified));
+		
+		if (!bShowInternalEnums && EnumHasAnyFlags(PathFlags, EEnumPathFlags::InternalOnly))
+		{
+			return false;
+		}
+
+		if (EnumHasAnyFlags(PathFlags, EEnumPathFlags::Developer))
+		{
+			if (DeveloperType == EEnumViewerDeveloperType::None)
+			{
+				return false;
+			}
+			
+			if (DeveloperType == EEnumViewerDeveloperType::CurrentUser &&
+				!EnumHasAnyFlags(PathFlags, EEnumPathFlags::CurrentUserDeveloper))
+			{
+				return false;
+			}
+		}
+
+		if (TextFilter != nullptr && !PassesTextFilter(InNodeIndex))
+		{
+			return false;
+		}
+
+		// Only the check for unloaded enums and the filter of the init options need the node itself.
+		OutEnum = nullptr;
+		if (!NeedsEnum())
+		{
+			return true;
+		}
+
+		OutEnum = Snapshot.GetNode(InNodeIndex)->GetEnum();
+		return (OutEnum != nullptr || InitOptions.bShowUnloadedEnums);
+	}
+
+	bool FEnumViewerFilterContext::IsPlainTerm(const FString& InFilterText)
+	{
+		for (const TCHAR Char : InFilterText)
+		{
+			if (!FChar::IsAlnum(Char) && Char != TEXT('_'))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool FEnumViewerFilterContext::PassesTextFilter(const int32 InNodeIndex) const
+	{
+		FString& EnumNameBuffer = EnumViewerFilterContextInternal::GetEnumNameBuffer();
+		if (FuzzyMatcher.IsSet())
+		{
+			Snapshot.GetEnumNames()[InNodeIndex].ToString(EnumNameBuffer);
+			return FuzzyMatcher->Matches(EnumNameBuffer);
+		}
+
+		// Names that could not be case-folded into the search keys are tested by the evaluator, as are complex queries.
+		if (bHasSearchKeyMatches && (UnsupportedSearchKeys == nullptr || !(*UnsupportedSearchKeys)[InNodeIndex]))
+		{
+			return SearchKeyMatches[InNodeIndex];
+		}
+
+		Snapshot.GetEnumNames()[InNodeIndex].ToString(EnumNameBuffer);
+		return TextFilter->TestTextFilter(EnumViewerFilterContextInternal::FEnumFilterExpressionContext(Snapshot, InNodeIndex, EnumNameBuffer));
+	}
+}
@@ -0,0 +1,102 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnumViewer/Data/EnumPathClassifier.h"
+#include "EnumViewer/Data/EnumFuzzyMatcher.h"
+
+class FTextFilterExpressionEvaluator;
+enum class EEnumViewerDeveloperType : uint8;
+
+namespace EnumViewer
+{
+	class FEnumViewerInitializationOptions;
+	class FEnumRegistrySnapshot;
+
+	/**
+	 * The filter options of an enum viewer, resolved once when the list is populated.
+	 * Each node is then tested against the columns of the snapshot without recomputing the options or allocating memory.
+	 */
+	class FEnumViewerFilterContext
+	{
+	public:
+		// Constructor.
+		// The paths of the snapshot must have been classified beforehand.
+		FEnumViewerFilterContext(
+			const FEnumRegistrySnapshot& InSnapshot,
+			const FEnumViewerInitializationOptions& InInitOptions,
+			const EEnumViewerDeveloperType InDeveloperType,
+			const bool bInShowInternalEnums,
+			const TSharedPtr<FTextFilterExpressionEvaluator>& InTextFilter
+		);
+
+		// Finds the candidates whose names contain the search query if it's a plain term, so that they don't have to be tested one by one.
+		// Only the specified candidates can be filtered afterwards. This does nothing if there are no candidates.
+		void MatchPlainTerm(TArrayView<const int32> InCandidateIndices);
+
+		// Appends the registry indices of the nodes that pass the filter, keeping their order.
+		// The filter of the init options is called once for the loaded enums and once for the unloaded ones among them.
+		void FilterNodeIndices(TArrayView<const int32> InNodeIndices, TArray<int32>& OutNodeIndices) const;
+
+		// Returns whether FilterNodeIndices can be called from multiple threads at the same time.
+		// This is only the case if the filter reads nothing but the columns of the snapshot,
+		// which means no enum has to be resolved and the search query doesn't have to be evaluated for any node.
+		bool IsThreadSafe() const;
+
+		// Returns whether the nodes that pass the filter should be ranked by how well they match the search query.
+		bool IsRankingByScore() const;
+
+		// Moves the nodes that best match the search query to the front, best first.
+		// The number of ranked nodes is limited by the init options, and the remaining nodes keep their order.
+		void RankNodeIndices(TArray<int32>& InOutNodeIndices) const;
+
+		// Returns whether the search query consists of a single term without any operators.
+		static bool IsPlainTerm(const FString& InFilterText);
+
+	private:
+		// Returns whether the enums of the nodes have to be resolved, either to hide the unloaded ones or to pass them to the filter of the init options.
+		bool NeedsEnum() const;
+
+		// Returns whether the search query has to be evaluated for some nodes, rather than being matched as a plain term.
+		bool NeedsTextFilterEvaluator() const;
+
+		// Returns whether the node at the specified registry index passes the checks other than the filter of the init options.
+		// The enum of the node is also returned if it's needed, or null if it's not loaded or not needed.
+		bool PassesBuiltInFilters(const int32 InNodeIndex, const UEnum*& OutEnum) const;
+
+		// Returns whether the node at the specified registry index passes the search query.
+		bool PassesTextFilter(const int32 InNodeIndex) const;
+
+	private:
+		// The snapshot whose nodes are tested.
+		const FEnumRegistrySnapshot& Snapshot;
+		
+		// The init options of the enum viewer being populated.
+		const FEnumViewerInitializationOptions& InitOptions;
+
+		// The developer folder view mode.
+		EEnumViewerDeveloperType DeveloperType;
+
+		// Whether to show the enums considered Internal Only.
+		bool bShowInternalEnums;
+
+		// The compiled search terms, or null if there are none.
+		const FTextFilterExpressionEvaluator* TextFilter;
+
+		// The matcher for the search query if it's a plain term in fuzzy search mode.
+		TOptional<FEnumFuzzyMatcher> FuzzyMatcher;
+
+		// The search query if it's a plain term in substring search mode, or empty otherwise.
+		FString PlainTerm;
+
+		// The candidates whose names contain the plain term, indexed by registry index, filled by MatchPlainTerm.
+		TBitArray<> SearchKeyMatches;
+
+		// Whether SearchKeyMatches has been filled.
+		bool bHasSearchKeyMatches;
+
+		// The nodes whose names are not included in the search keys, or null if all nodes are covered by SearchKeyMatches.
+		const TBitArray<>* UnsupportedSearchKeys;
+	};
+}
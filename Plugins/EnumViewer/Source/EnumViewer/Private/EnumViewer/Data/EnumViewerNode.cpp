@@ -3,6 +3,7 @@
 #include "EnumViewer/Data/EnumViewerNode.h"
 #include "EnumViewer/Utilities/EnumViewerUtils.h"
 #include "EnumViewer/Types/EnumViewerInitializationOptions.h"
+#include "EnumViewer/Data/EnumRegistry.h"
 #include "Engine/UserDefinedEnum.h"
 #include "Misc/ScopedSlowTask.h"
 
@@ -21,43 +22,29 @@ namespace EnumViewer
 	{
 		check(Enum.IsValid());
 
-		EnumName = Enum->GetName();
-		EnumDisplayName = FEnumViewerUtils::GetEnumDisplayName(Enum);
+		EnumName = Enum->GetFName();
 		EnumPath = *Enum->GetPathName();
+		PackageName = Enum->GetOutermost()->GetFName();
 	}
 
-	FEnumViewerNode::FEnumViewerNode(const FAssetData& InEnumAsset)
-		: EnumName(InEnumAsset.AssetName.ToString())
-		, EnumPath(InEnumAsset.ObjectPath)
+	FEnumViewerNode::FEnumViewerNode(const TWeakObjectPtr<const UEnum>& InEnum, const FName& InEnumName, const FName& InEnumPath, const FName& InPackageName)
+		: Enum(InEnum)
+		, EnumName(InEnumName)
+		, EnumPath(InEnumPath)
+		, PackageName(InPackageName)
 	{
-		// Attempt to find the enum asset in the case where it's already been loaded.
-		Enum = FindObject<UEnum>(ANY_PACKAGE, *EnumPath.ToString());
-
-		// Cache the resolved display name if available, or synthesize one if the enum asset is unloaded.
-		if (Enum.IsValid())
-		{
-			EnumDisplayName = FText::FromString(Enum->GetMetaData(TEXT("DisplayName")));
-		}
-		else
-		{
-			EnumDisplayName = FText::AsCultureInvariant(FName::NameToDisplayString(EnumName, false));
-		}
 	}
 
-	FEnumViewerNode::FEnumViewerNode(
-		const TSharedPtr<FEnumViewerNode>& Other,
-		const TSharedPtr<IPropertyHandle>& InPropertyHandle,
-		const bool bInPassedFilter
-	)
-		: PropertyHandle(InPropertyHandle)
-		, bPassedFilter(bInPassedFilter)
+	FEnumViewerNode::FEnumViewerNode(const FAssetData& InEnumAsset, const bool bInFindLoadedEnum)
+		: EnumName(InEnumAsset.AssetName)
+		, EnumPath(InEnumAsset.ObjectPath)
+		, PackageName(InEnumAsset.PackageName)
 	{
-		if (Other.IsValid())
+		// Attempt to find the enum asset in the case where it's already been loaded.
+		if (bInFindLoadedEnum)
 		{
-			Enum = Other->Enum;
-			EnumName = Other->EnumName;
-			EnumDisplayName = Other->EnumDisplayName;
-			EnumPath = Other->EnumPath;
+			check(IsInGameThread());
+			Enum = FindObject<UEnum>(ANY_PACKAGE, *EnumPath.ToString());
 		}
 	}
 
@@ -66,57 +53,92 @@ namespace EnumViewer
 		return Enum.Get();
 	}
 
-	const FString& FEnumViewerNode::GetEnumName() const
+	FString FEnumViewerNode::GetEnumName() const
+	{
+		return EnumName.ToString();
+	}
+
+	const FName& FEnumViewerNode::GetEnumFName() const
 	{
 		return EnumName;
 	}
 
 	const FText& FEnumViewerNode::GetEnumDisplayName() const
 	{
-		return EnumDisplayName;
+		// Resolve the display name if available, or synthesize one if the enum asset is unloaded.
+		if (!EnumDisplayName.IsSet())
+		{
+			if (Enum.IsValid())
+			{
+				EnumDisplayName = FEnumViewerUtils::GetEnumDisplayName(Enum);
+			}
+			else
+			{
+				EnumDisplayName = FText::AsCultureInvariant(FName::NameToDisplayString(GetEnumName(), false));
+			}
+		}
+		
+		return EnumDisplayName.GetValue();
 	}
 
-	FText FEnumViewerNode::GetEnumDisplayName(const EEnumViewerNameTypeToDisplay InNameType) const
+	const FText& FEnumViewerNode::GetEnumDisplayName(const EEnumViewerNameTypeToDisplay InNameType) const
 	{
-		FText ReturnValue = FText::GetEmpty();
-		switch (InNameType)
+		if (InNameType == EEnumViewerNameTypeToDisplay::DisplayName)
 		{
-		case EEnumViewerNameTypeToDisplay::EnumName:
-		{
-			ReturnValue = FText::AsCultureInvariant(GetEnumName());
-			break;
+			return GetEnumDisplayName();
 		}
-		case EEnumViewerNameTypeToDisplay::DisplayName:
+
+		if (!DisplayNameCache.IsValid())
 		{
-			ReturnValue = GetEnumDisplayName();
-			break;
+			DisplayNameCache = MakeUnique<FDisplayNameCache>();
 		}
-		case EEnumViewerNameTypeToDisplay::Dynamic:
+
+		switch (InNameType)
+		{
+		case EEnumViewerNameTypeToDisplay::EnumName:
 		{
-			const FString DisplayName = EnumDisplayName.ToString();
-			const FString SynthesizedDisplayName = FName::NameToDisplayString(EnumName, false);
-			if (DisplayName.IsEmpty() ||
-				DisplayName.Equals(EnumName) ||
-				DisplayName.Equals(SynthesizedDisplayName))
+			if (!DisplayNameCache->EnumName.IsSet())
 			{
-				ReturnValue = FText::FromString(EnumName);
+				DisplayNameCache->EnumName = FText::AsCultureInvariant(GetEnumName());
 			}
-			else
+			return DisplayNameCache->EnumName.GetValue();
+		}
+		case EEnumViewerNameTypeToDisplay::Dynamic:
+		{
+			if (!DisplayNameCache->Dynamic.IsSet())
 			{
-				ReturnValue = FText::Format(
-					LOCTEXT("EnumDynamicDisplayNameFormat", "{0} ({1})"),
-					FText::FromString(EnumName),
-					FText::FromString(DisplayName)
-				);
+				const FString EnumNameString = GetEnumName();
+				const FString DisplayName = GetEnumDisplayName().ToString();
+				const FString SynthesizedDisplayName = FName::NameToDisplayString(EnumNameString, false);
+				if (DisplayName.IsEmpty() ||
+					DisplayName.Equals(EnumNameString) ||
+					DisplayName.Equals(SynthesizedDisplayName))
+				{
+					DisplayNameCache->Dynamic = FText::FromString(EnumNameString);
+				}
+				else
+				{
+					DisplayNameCache->Dynamic = FText::Format(
+						LOCTEXT("EnumDynamicDisplayNameFormat", "{0} ({1})"),
+						FText::FromString(EnumNameString),
+						FText::FromString(DisplayName)
+					);
+				}
 			}
-			break;
+			return DisplayNameCache->Dynamic.GetValue();
 		}
 		default:
 			ensureMsgf(false, TEXT("FEnumViewerNode::GetEnumName called with invalid name type."));
 			break;
 		}
 
-		return ReturnValue;
+		return FText::GetEmpty();
+	}
+
+	void FEnumViewerNode::ResetEnumDisplayNames() const
+	{
+		EnumDisplayName.Reset();
+		DisplayNameCache.Reset();
 	}
 
 	const FName& FEnumViewerNode::GetEnumPath() const
@@ -124,6 +146,11 @@ namespace EnumViewer
 		return EnumPath;
 	}
 
+	const FName& FEnumViewerNode::GetPackageName() const
+	{
+		return PackageName;
+	}
+
 	const UUserDefinedEnum* FEnumViewerNode::GetEnumAsset() const
 	{
 		return Cast<UUserDefinedEnum>(Enum.Get());
@@ -145,35 +172,58 @@ namespace EnumViewer
 			Enum = LoadObject<UEnum>(nullptr, *EnumPath.ToString());
 		}
 
-		// Re-cache the resolved display name as it may be different than the one
+		// Re-resolve the display name as it may be different than the one
 		// we synthesized for an unloaded enum asset.
 		if (Enum.IsValid())
 		{
-			EnumDisplayName = FEnumViewerUtils::GetEnumDisplayName(Enum);
+			ResetEnumDisplayNames();
+			NotifyEnumChanged();
 			return true;
 		}
 
 		return false;
 	}
 
-	bool FEnumViewerNode::IsRestricted() const
+	bool FEnumViewerNode::IsEnumStale() const
 	{
-		if (PropertyHandle.IsValid())
+		return Enum.IsStale();
+	}
+
+	void FEnumViewerNode::ResetEnum() const
+	{
+		Enum.Reset();
+
+		// The display name will be synthesized again.
+		ResetEnumDisplayNames();
+		NotifyEnumChanged();
+	}
+
+	void FEnumViewerNode::NotifyEnumChanged() const
+	{
+		if (RegistryIndex == INDEX_NONE)
 		{
-			return PropertyHandle->IsRestricted(GetEnumName());
+			return;
 		}
 
-		return false;
+		if (auto* EnumRegistry = FEnumRegistry::GetPtr())
+		{
+			EnumRegistry->OnNodeEnumChanged(*this);
+		}
 	}
 
-	const TSharedPtr<IPropertyHandle>& FEnumViewerNode::GetPropertyHandle() const
+	bool FEnumViewerNode::IsRestricted(const TSharedPtr<IPropertyHandle>& InPropertyHandle) const
 	{
-		return PropertyHandle;
+		if (InPropertyHandle.IsValid())
+		{
+			return InPropertyHandle->IsRestricted(GetEnumName());
+		}
+
+		return false;
 	}
 
-	bool FEnumViewerNode::PassedFilter()
+	int32 FEnumViewerNode::GetRegistryIndex() const
 	{
-		return bPassedFilter;
+		return RegistryIndex;
 	}
 }
 
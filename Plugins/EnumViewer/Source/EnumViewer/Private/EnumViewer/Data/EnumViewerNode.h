@@ -24,63 +24,101 @@ namespace EnumViewer
 		// Create a node representing the given enum.
 		explicit FEnumViewerNode(const UEnum* InEnum);
 
-		// Create a node representing the given enum asset (may be unloaded).
-		explicit FEnumViewerNode(const FAssetData& InEnumAsset);
+		// Create a node representing the given enum from the names already read from it.
+		// The enum isn't dereferenced, so this can be done on any thread.
+		explicit FEnumViewerNode(const TWeakObjectPtr<const UEnum>& InEnum, const FName& InEnumName, const FName& InEnumPath, const FName& InPackageName);
 
-		// Create a copy of node by specifying the property handle and whether passed the search filter.
-		explicit FEnumViewerNode(
-			const TSharedPtr<FEnumViewerNode>& Other,
-			const TSharedPtr<IPropertyHandle>& InPropertyHandle,
-			const bool bInPassedFilter
-		);
+		// Create a node representing the given enum asset (may be unloaded).
+		// If requested, the enum is looked up in case it's already loaded, which must only be done on the game thread.
+		explicit FEnumViewerNode(const FAssetData& InEnumAsset, const bool bInFindLoadedEnum = true);
 
 		// Get the enum that we represent (for loaded enum assets, or native enums).
 		const UEnum* GetEnum() const;
 		
 		// Get the unlocalized name of the enum we represent.
-		const FString& GetEnumName() const;
+		FString GetEnumName() const;
+
+		// Get the interned unlocalized name of the enum we represent.
+		const FName& GetEnumFName() const;
 
 		// Get the localized name of the enum we represent.
+		// This is resolved on first access, as most nodes are never displayed.
 		const FText& GetEnumDisplayName() const;
 
 		// Get the display name of the enum we represent, built based on the given option.
-		FText GetEnumDisplayName(const EEnumViewerNameTypeToDisplay InNameType) const;
+		// Each of these is built on first access and cached until the display name needs to be resolved again.
+		const FText& GetEnumDisplayName(const EEnumViewerNameTypeToDisplay InNameType) const;
+
+		// Forget the resolved display name and the names built from it, such as when the culture has changed.
+		void ResetEnumDisplayNames() const;
 
 		// Get the full object path to the enum we represent.
 		const FName& GetEnumPath() const;
 
+		// Get the name of the package that contains the enum we represent.
+		const FName& GetPackageName() const;
+
 		// Get the enum asset that we represent (for loaded enum assets).
 		const UUserDefinedEnum* GetEnumAsset() const;
 
 		// Trigger a load of the enum we represent.
 		bool LoadEnum() const;
 
-		// Check whether this enum is restricted for the specific context.
-		bool IsRestricted() const;
+		// Returns whether the enum we represent has been loaded but no longer exists, such as after garbage collection or a module unload.
+		bool IsEnumStale() const;
+
+		// Forget the enum we represent, returning to the unloaded enum asset state.
+		void ResetEnum() const;
 
-		// Get the property this filtered node will be working on.
-		const TSharedPtr<IPropertyHandle>& GetPropertyHandle() const;
+		// Check whether this enum is restricted for the property the viewer is working on.
+		bool IsRestricted(const TSharedPtr<IPropertyHandle>& InPropertyHandle) const;
 
-		// Returns whether this enum passed the search filter.
-		bool PassedFilter();
+		// Get the index of this node in the Enum Registry, or INDEX_NONE if this node is not registered.
+		// Viewers use this index to keep per-node state without copying the node.
+		int32 GetRegistryIndex() const;
 		
 	private:
+		// Tells the Enum Registry that the enum we represent has been loaded or reset, if this node is registered.
+		void NotifyEnumChanged() const;
+		
+	private:
+		/**
+		 * The names displayed for the enum we represent other than the display name itself, built on first access.
+		 */
+		struct FDisplayNameCache
+		{
+		public:
+			// The name displayed for EEnumViewerNameTypeToDisplay::EnumName.
+			TOptional<FText> EnumName;
+
+			// The name displayed for EEnumViewerNameTypeToDisplay::Dynamic.
+			TOptional<FText> Dynamic;
+		};
+
+	private:
+		friend class FEnumRegistrySnapshot;
+		
 		// The enum that we represent (for loaded enum assets, or native enums).
 		mutable TWeakObjectPtr<const UEnum> Enum;
 		
 		// The unlocalized name of the enum we represent.
-		FString EnumName;
+		FName EnumName;
+
+		// The localized name of the enum we represent, or unset if it's not resolved yet.
+		mutable TOptional<FText> EnumDisplayName;
 
-		// The localized name of the enum we represent.
-		mutable FText EnumDisplayName;
+		// The other names displayed for the enum we represent.
+		// This is only allocated for the nodes that are displayed, which are a small part of the registry.
+		mutable TUniquePtr<FDisplayNameCache> DisplayNameCache;
 
 		// The full object path to the enum we represent.
 		FName EnumPath;
 
-		// The property this filtered node will be working on.
-		TSharedPtr<IPropertyHandle> PropertyHandle;
+		// The name of the package that contains the enum we represent.
+		// For native enums, this is the script package of the owning module.
+		FName PackageName;
 
-		// Whether this enum passed the search filter.
-		bool bPassedFilter;
+		// The index of this node in the Enum Registry.
+		int32 RegistryIndex = INDEX_NONE;
 	};
 }
\ No newline at end of file
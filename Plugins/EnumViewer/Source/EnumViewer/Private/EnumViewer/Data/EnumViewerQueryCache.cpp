@@ -0,0 +1,77 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumViewerQueryCache.h"
+#include "EnumViewer/Data/EnumViewerFilterContext.h"
+
+namespace EnumViewer
+{
+	namespace EnumViewerQueryCacheInternal
+	{
+		// The maximum number of queries kept in the cache.
+		static constexpr int32 MaxEntries = 8;
+	}
+
+	const TArray<int32>* FEnumViewerQueryCache::Find(const FString& InFilterText)
+	{
+		const int32 Index = Entries.IndexOfByPredicate(
+			[&InFilterText](const FEntry& Entry) -> bool
+			{
+				return Entry.FilterText.Equals(InFilterText, ESearchCase::IgnoreCase);
+			}
+		);
+		if (Index == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		// Mark the entry as the most recently used one.
+		if (Index != Entries.Num() - 1)
+		{
+			FEntry Entry = MoveTemp(Entries[Index]);
+			Entries.RemoveAt(Index, 1, false);
+			Entries.Add(MoveTemp(Entry));
+		}
+
+		return &Entries.Last().NodeIndices;
+	}
+
+	const TArray<int32>* FEnumViewerQueryCache::FindRefinementBase(const FString& InFilterText) const
+	{
+		const FEntry* BestEntry = nullptr;
+		for (const FEntry& Entry : Entries)
+		{
+			if (IsRefinementOf(InFilterText, Entry.FilterText) &&
+				(BestEntry == nullptr || Entry.FilterText.Len() > BestEntry->FilterText.Len()))
+			{
+				BestEntry = &Entry;
+			}
+		}
+
+		return (BestEntry != nullptr ? &BestEntry->NodeIndices : nullptr);
+	}
+
+	void FEnumViewerQueryCache::Add(const FString& InFilterText, const TArray<int32>& InNodeIndices)
+	{
+		if (Entries.Num() >= EnumViewerQueryCacheInternal::MaxEntries)
+		{
+			Entries.RemoveAt(0, 1, false);
+		}
+
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.FilterText = InFilterText;
+		Entry.NodeIndices = InNodeIndices;
+	}
+
+	void FEnumViewerQueryCache::Reset()
+	{
+		Entries.Reset();
+	}
+
+	bool FEnumViewerQueryCache::IsRefinementOf(const FString& InNewFilterText, const FString& InOldFilterText)
+	{
+		return (
+			InNewFilterText.StartsWith(InOldFilterText, ESearchCase::IgnoreCase) &&
+			FEnumViewerFilterContext::IsPlainTerm(InNewFilterText)
+		);
+	}
+}
@@ -0,0 +1,53 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EnumViewer
+{
+	/**
+	 * A small least recently used cache of the nodes that passed the filter of an enum viewer for recent search queries.
+	 * The results are only valid as long as nothing but the search query changes, so the cache must be reset otherwise.
+	 */
+	class FEnumViewerQueryCache
+	{
+	public:
+		// Returns the registry indices cached for the query, or null if there are none.
+		// The returned pointer is only valid until the cache is modified.
+		const TArray<int32>* Find(const FString& InFilterText);
+
+		// Returns the registry indices cached for the longest query that the specified query refines, or null if there are none.
+		// Since a refinement can only match fewer nodes, only these need to be filtered again.
+		// The returned pointer is only valid until the cache is modified.
+		const TArray<int32>* FindRefinementBase(const FString& InFilterText) const;
+
+		// Adds the registry indices for the query, evicting the least recently used one if the cache is full.
+		void Add(const FString& InFilterText, const TArray<int32>& InNodeIndices);
+
+		// Removes all the cached queries.
+		void Reset();
+
+		// Returns whether the new query can only match a subset of what the old query matches.
+		// To stay on the safe side, this only accepts queries of a single plain term extended at the end,
+		// as operators, quotes and negations don't narrow the result in the same way.
+		static bool IsRefinementOf(const FString& InNewFilterText, const FString& InOldFilterText);
+
+	private:
+		/**
+		 * A query and its result.
+		 */
+		struct FEntry
+		{
+		public:
+			// The text of the search query.
+			FString FilterText;
+
+			// The registry indices of the nodes that passed the filter, sorted alphabetically.
+			TArray<int32> NodeIndices;
+		};
+
+		// The cached queries, from the least recently used to the most recently used.
+		TArray<FEntry> Entries;
+	};
+}
@@ -0,0 +1,89 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#include "EnumViewer/Data/EnumViewerSearchJob.h"
+#include "EnumViewer/Data/EnumRegistry.h"
+
+namespace EnumViewer
+{
+	namespace EnumViewerSearchJobInternal
+	{
+		// The time that a search can spend per frame, in seconds.
+		static constexpr double FrameBudget = 0.004;
+
+		// The number of candidates tested at once.
+		// Large enough to be split up for parallel filtering, small enough to fill the first screen quickly.
+		static constexpr int32 BatchSize = 8192;
+	}
+
+	FEnumViewerSearchJob::FEnumViewerSearchJob(
+		const FEnumRegistrySnapshotPtr& InSnapshot,
+		const FEnumViewerInitializationOptions& InInitOptions,
+		const EEnumViewerDeveloperType InDeveloperType,
+		const bool bInShowInternalEnums,
+		const TSharedPtr<FTextFilterExpressionEvaluator>& InTextFilter,
+		const TArray<int32>& InCandidateIndices
+	)
+		: Snapshot(InSnapshot)
+		, Generation(InSnapshot->GetGeneration())
+		, FilterContext(*InSnapshot, InInitOptions, InDeveloperType, bInShowInternalEnums, InTextFilter)
+		, CandidateIndices(InCandidateIndices)
+		, NextCandidateIndex(0)
+	{
+		// A job completed with known matches has no candidates, so the names aren't searched at all.
+		FilterContext.MatchPlainTerm(CandidateIndices);
+	}
+
+	void FEnumViewerSearchJob::Tick()
+	{
+		const double EndTime = FPlatformTime::Seconds() + EnumViewerSearchJobInternal::FrameBudget;
+		const bool bIsThreadSafe = FilterContext.IsThreadSafe();
+		auto BatchFilter = [this](TArrayView<const int32> CandidateIndices, TArray<int32>& OutPassedIndices)
+		{
+			FilterContext.FilterNodeIndices(CandidateIndices, OutPassedIndices);
+		};
+
+		do
+		{
+			const int32 NumToTest = FMath::Min(EnumViewerSearchJobInternal::BatchSize, CandidateIndices.Num() - NextCandidateIndex);
+			FEnumRegistry::FilterNodeIndices(
+				BatchFilter,
+				MakeArrayView(CandidateIndices.GetData() + NextCandidateIndex, NumToTest),
+				MatchedNodeIndices,
+				bIsThreadSafe
+			);
+			NextCandidateIndex += NumToTest;
+		}
+		while (!IsComplete() && FPlatformTime::Seconds() < EndTime);
+	}
+
+	void FEnumViewerSearchJob::CompleteWith(const TArray<int32>& InMatchedNodeIndices)
+	{
+		MatchedNodeIndices = InMatchedNodeIndices;
+		NextCandidateIndex = CandidateIndices.Num();
+	}
+
+	bool FEnumViewerSearchJob::IsComplete() const
+	{
+		return (NextCandidateIndex >= CandidateIndices.Num());
+	}
+
+	const TArray<int32>& FEnumViewerSearchJob::GetMatchedNodeIndices() const
+	{
+		return MatchedNodeIndices;
+	}
+
+	const FEnumViewerFilterContext& FEnumViewerSearchJob::GetFilterContext() const
+	{
+		return FilterContext;
+	}
+
+	const FEnumRegistrySnapshot& FEnumViewerSearchJob::GetSnapshot() const
+	{
+		return *Snapshot;
+	}
+
+	bool FEnumViewerSearchJob::IsOutdated() const
+	{
+		return (Snapshot != FEnumRegistry::Get().GetSnapshotPtr() || Snapshot->GetGeneration() != Generation);
+	}
+}
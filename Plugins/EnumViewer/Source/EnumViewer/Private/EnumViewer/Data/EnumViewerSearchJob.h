@@ -0,0 +1,74 @@
+// Copyright 2022 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnumViewer/Data/EnumRegistrySnapshot.h"
+#include "EnumViewer/Data/EnumViewerFilterContext.h"
+
+namespace EnumViewer
+{
+	/**
+	 * A search of the Enum Registry that is spread over multiple frames, so that typing never waits for the whole registry to be filtered.
+	 * The candidates are tested in batches within a time budget per tick, and the matches can be shown as they are found.
+	 * The search is cancelled by destroying the job, which must be done before the init options or the text filter change.
+	 * The job keeps the snapshot it searches alive, but the registry updates that snapshot in place,
+	 * so the job must also be destroyed without reading its matches once it's outdated.
+	 */
+	class FEnumViewerSearchJob
+	{
+	public:
+		// Constructor.
+		// The candidates are tested in the order given, and the matches keep that order.
+		FEnumViewerSearchJob(
+			const FEnumRegistrySnapshotPtr& InSnapshot,
+			const FEnumViewerInitializationOptions& InInitOptions,
+			const EEnumViewerDeveloperType InDeveloperType,
+			const bool bInShowInternalEnums,
+			const TSharedPtr<FTextFilterExpressionEvaluator>& InTextFilter,
+			const TArray<int32>& InCandidateIndices
+		);
+
+		// Tests the next batches of candidates until the time budget for this frame runs out.
+		// At least one batch is tested per call so that the search always makes progress.
+		void Tick();
+
+		// Completes the search with matches that are already known, such as the cached result of the same query.
+		void CompleteWith(const TArray<int32>& InMatchedNodeIndices);
+
+		// Returns whether all candidates have been tested.
+		bool IsComplete() const;
+
+		// Returns the registry indices of the matches found so far.
+		const TArray<int32>& GetMatchedNodeIndices() const;
+
+		// Returns the filter context used to test the candidates.
+		const FEnumViewerFilterContext& GetFilterContext() const;
+
+		// Returns the snapshot that the registry indices of the candidates and the matches refer to.
+		const FEnumRegistrySnapshot& GetSnapshot() const;
+
+		// Returns whether the snapshot searched is no longer the one published, or has been changed since the search started.
+		// The registry indices held by an outdated search may refer to other nodes or to none at all.
+		bool IsOutdated() const;
+
+	private:
+		// The snapshot searched.
+		FEnumRegistrySnapshotPtr Snapshot;
+
+		// The generation of the snapshot when the search started.
+		uint32 Generation;
+
+		// The resolved filter options.
+		FEnumViewerFilterContext FilterContext;
+
+		// The registry indices of the nodes to test.
+		TArray<int32> CandidateIndices;
+
+		// The index in CandidateIndices of the next candidate to test.
+		int32 NextCandidateIndex;
+
+		// The registry indices of the candidates that passed the filter.
+		TArray<int32> MatchedNodeIndices;
+	};
+}
@@ -24,10 +24,22 @@ namespace EnumViewer
 	}
 }
 
+UEnumViewerProjectSettings::FSettingChangedEvent UEnumViewerProjectSettings::SettingChangedEvent;
+
 UEnumViewerProjectSettings::UEnumViewerProjectSettings()
+	: RegistryRebuildDebounceTime(0.25f)
+	, RegistryRebuildMode(EEnumRegistryRebuildMode::Background)
+	, RegistryRebuildFrameBudget(2.0f)
+	, bEnableSearchIndex(true)
+	, SearchIndexMinRegistrySize(20000)
 {
 }
 
+UEnumViewerProjectSettings::FSettingChangedEvent& UEnumViewerProjectSettings::OnSettingChanged()
+{
+	return SettingChangedEvent;
+}
+
 void UEnumViewerProjectSettings::Register()
 {
 	if (ISettingsModule* SettingsModule = EnumViewer::EnumViewer::ProjectSettings::GetSettingsModule())
@@ -62,4 +74,19 @@ const UEnumViewerProjectSettings& UEnumViewerProjectSettings::Get()
 	return *Settings;
 }
 
+void UEnumViewerProjectSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Edits to array elements report the array itself as the member property.
+	const FName MemberPropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UEnumViewerProjectSettings, InternalOnlyPaths) ||
+		MemberPropertyName == GET_MEMBER_NAME_CHECKED(UEnumViewerProjectSettings, InternalOnlyEnums) ||
+		MemberPropertyName == GET_MEMBER_NAME_CHECKED(UEnumViewerProjectSettings, bEnableSearchIndex) ||
+		MemberPropertyName == GET_MEMBER_NAME_CHECKED(UEnumViewerProjectSettings, SearchIndexMinRegistrySize))
+	{
+		SettingChangedEvent.Broadcast();
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
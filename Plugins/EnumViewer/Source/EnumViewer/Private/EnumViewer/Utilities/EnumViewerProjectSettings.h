@@ -8,6 +8,18 @@
 #include "Engine/EngineTypes.h"
 #include "EnumViewerProjectSettings.generated.h"
 
+/**
+ * The ways to rebuild the Enum Registry.
+ */
+UENUM()
+enum class EEnumRegistryRebuildMode : uint8
+{
+	// Build a new list on a worker thread and replace the current one when it's done.
+	Background,
+	// Update the current list on the game thread a little at a time, within the frame budget.
+	TimeSliced,
+};
+
 /**
  * Project settings for enum viewer.
  */
@@ -25,9 +37,37 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Enum Visibility Management", meta = (DisplayName = "List of base enums to consider Internal Only.", ShowTreeView, HideViewOptions))
 	TArray<TSoftObjectPtr<const UEnum>> InternalOnlyEnums;
 
+	// The time to wait after the last change before rebuilding the Enum Registry.
+	// Changes made while waiting or while a rebuild is in progress are coalesced into a single rebuild.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = 0.0, Units = "s"))
+	float RegistryRebuildDebounceTime;
+
+	// How to rebuild the Enum Registry.
+	// Rebuilds are deferred while no enum viewer is open in either mode.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	EEnumRegistryRebuildMode RegistryRebuildMode;
+
+	// The time that a time-sliced rebuild can spend per frame.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = 0.1, Units = "ms", EditCondition = "RegistryRebuildMode == EEnumRegistryRebuildMode::TimeSliced"))
+	float RegistryRebuildFrameBudget;
+
+	// Whether to keep a trigram index of the enum names to speed up searching.
+	// Searching for a term shorter than three characters always scans all names.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	bool bEnableSearchIndex;
+
+	// The number of enums in the Enum Registry above which the search index is built.
+	// Below this, scanning all names is fast enough and the index would only cost memory.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = 0, EditCondition = "bEnableSearchIndex"))
+	int32 SearchIndexMinRegistrySize;
+
 public:
 	// Constructor.
 	UEnumViewerProjectSettings();
+
+	// Returns an event delegate that is executed when the internal only paths or enums, or the search index settings have changed.
+	DECLARE_EVENT(UEnumViewerProjectSettings, FSettingChangedEvent);
+	static FSettingChangedEvent& OnSettingChanged();
 	
 	// Register - unregister in the editor setting item.
 	static void Register();
@@ -35,4 +75,13 @@ public:
 	
 	// Returns reference of this settings.
 	static const UEnumViewerProjectSettings& Get();
+
+protected:
+	// UObject interface.
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+	// End of UObject interface.
+
+private:
+	// Holds an event delegate that is executed when the internal only paths or enums have changed.
+	static FSettingChangedEvent SettingChangedEvent;
 };
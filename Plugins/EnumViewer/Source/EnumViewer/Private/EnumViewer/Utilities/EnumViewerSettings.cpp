@@ -23,18 +23,17 @@ void UEnumViewerSettings::PostEditChangeProperty(FPropertyChangedEvent& Property
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
-	if (PropertyChangedEvent.Property == nullptr)
-	{
-		return;
-	}
-	
 	if (!FUnrealEdMisc::Get().IsDeletePreferences())
 	{
 		SaveConfig();
 	}
 
-	if (PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UEnumViewerSettings, bDisplayInternalEnums) ||
-		PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UEnumViewerSettings, DeveloperFolderType))
+	// Changes made through FEnumViewerSettingsModifier don't specify the property, so treat them as changes to any of them.
+	// The viewers cache their filter results, so they must be notified of every change to the view options.
+	if (PropertyChangedEvent.Property == nullptr ||
+		PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UEnumViewerSettings, bDisplayInternalEnums) ||
+		PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UEnumViewerSettings, DeveloperFolderType) ||
+		PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UEnumViewerSettings, SortType))
 	{
 		SettingChangedEvent.Broadcast();
 	}
@@ -59,6 +58,15 @@ namespace EnumViewer
 			Settings->PostEditChange();
 		}
 	}
+
+	void FEnumViewerSettingsModifier::SetSortType(EEnumViewerSortType NewType)
+	{
+		if (auto* Settings = GetMutableDefault<UEnumViewerSettings>())
+		{
+			Settings->SortType = NewType;
+			Settings->PostEditChange();
+		}
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -22,6 +22,26 @@ enum class EEnumViewerDeveloperType : uint8
 	Max,
 };
 
+/**
+ * The orders in which SEnumViewer lists enums.
+ */
+UENUM()
+enum class EEnumViewerSortType : uint8
+{
+	// Sort alphabetically by enum name.
+	Name,
+	// Sort alphabetically by display name.
+	DisplayName,
+	// Sort by the module or mount point that contains the enum, then by enum name.
+	Module,
+	// Sort by the number of values, fewest first, then by enum name.
+	NumValues,
+	// Sort the most recently picked enums first, then the others by enum name.
+	LastPicked,
+	// Max sort type.
+	Max,
+};
+
 /**
  * User editor settings for each project for enum viewer.
  */
@@ -39,6 +59,10 @@ public:
 	UPROPERTY(Config)
 	EEnumViewerDeveloperType DeveloperFolderType;
 
+	// The order in which SEnumViewer lists enums.
+	UPROPERTY(Config)
+	EEnumViewerSortType SortType;
+
 public:
 	// Returns an event delegate that is executed when a setting has changed.
 	DECLARE_EVENT(UEnumViewerSettings, FSettingChangedEvent);
@@ -68,5 +92,6 @@ namespace EnumViewer
 		
 		static void SetDisplayInternalEnums(bool bNewState);
 		static void SetDeveloperFolderType(EEnumViewerDeveloperType NewType);
+		static void SetSortType(EEnumViewerSortType NewType);
 	};
 }
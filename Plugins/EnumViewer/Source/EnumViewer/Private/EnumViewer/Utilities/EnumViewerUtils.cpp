@@ -1,8 +1,6 @@
 // Copyright 2022 Naotsun. All Rights Reserved.
 
 #include "EnumViewer/Utilities/EnumViewerUtils.h"
-#include "EnumViewer/Types/EnumViewerInitializationOptions.h"
-#include "EnumViewer/Types/EnumViewerFilter.h"
 #include "SourceCodeNavigation.h"
 #include "Engine/UserDefinedEnum.h"
 #include "Misc/FileHelper.h"
@@ -21,34 +19,6 @@ namespace EnumViewer
 		return FText::GetEmpty();
 	}
 
-	bool FEnumViewerUtils::IsEnumAllowed(
-		const FEnumViewerInitializationOptions& InInitOptions,
-		const TWeakObjectPtr<const UEnum> InEnum
-	)
-	{
-		const TSharedPtr<IEnumViewerFilter> EnumFilter = InInitOptions.EnumFilter;
-		if (EnumFilter.IsValid())
-		{
-			return EnumFilter->IsEnumAllowed(InInitOptions, InEnum.Get());
-		}
-		
-		return true;
-	}
-
-	bool FEnumViewerUtils::IsUnloadedEnumAllowed(
-		const FEnumViewerInitializationOptions& InInitOptions,
-		const FName InEnumPath
-	)
-	{
-		const TSharedPtr<IEnumViewerFilter> EnumFilter = InInitOptions.EnumFilter;
-		if (EnumFilter.IsValid())
-		{
-			return EnumFilter->IsUnloadedEnumAllowed(InInitOptions, InEnumPath);
-		}
-		
-		return true;
-	}
-
 	void FEnumViewerUtils::OpenEnumInIDE(const UEnum* InEnum)
 	{
 		if (!IsValid(InEnum))
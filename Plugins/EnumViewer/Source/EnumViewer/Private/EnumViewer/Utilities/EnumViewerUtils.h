@@ -8,8 +8,6 @@ class UUserDefinedEnum;
 
 namespace EnumViewer
 {
-	class FEnumViewerInitializationOptions;
-
 	/**
 	 * A class that defines utility functions related to enums used in enum viewers.
 	 */
@@ -19,18 +17,6 @@ namespace EnumViewer
 		// Gets the display name specified by the target UENUM.
 		static FText GetEnumDisplayName(const TWeakObjectPtr<const UEnum> InEnum);
 
-		// Checks if the enum is allowed under the init options of the enum viewer currently building it's list.
-		static bool IsEnumAllowed(
-			const FEnumViewerInitializationOptions& InInitOptions,
-			const TWeakObjectPtr<const UEnum> InEnum
-		);
-
-		// Checks if the unloaded enum is allowed under the init options of the enum viewer currently building it's list.
-		static bool IsUnloadedEnumAllowed(
-			const FEnumViewerInitializationOptions& InInitOptions,
-			const FName InEnumPath
-		);
-
 		// Opens a enum source file.
 		static void OpenEnumInIDE(const UEnum* InEnum);
 		
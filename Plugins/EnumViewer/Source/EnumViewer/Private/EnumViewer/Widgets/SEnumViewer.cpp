@@ -3,14 +3,17 @@
 #include "EnumViewer/Widgets/SEnumViewer.h"
 #include "EnumViewer/EnumViewerGlobals.h"
 #include "EnumViewer/Utilities/EnumViewerSettings.h"
-#include "EnumViewer/Utilities/EnumViewerProjectSettings.h"
 #include "EnumViewer/Utilities/EnumViewerUtils.h"
 #include "EnumViewer/Data/EnumRegistry.h"
 #include "EnumViewer/Data/EnumViewerNode.h"
+#include "EnumViewer/Data/EnumViewerFilterContext.h"
+#include "EnumViewer/Data/EnumViewerQueryCache.h"
+#include "EnumViewer/Data/EnumViewerSearchJob.h"
 #include "EnumViewer/Widgets/SEnumViewerRow.h"
 #include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Layout/SSeparator.h"
 #include "Widgets/Layout/SScrollBorder.h"
+#include "Widgets/Images/SThrobber.h"
 #include "SListViewSelectorDropdownMenu.h"
 #include "Misc/TextFilterExpressionEvaluator.h"
 #include "EditorWidgetsModule.h"
@@ -26,58 +29,29 @@
 
 namespace EnumViewer
 {
-#if BEFORE_UE_4_25
-	namespace TextFilter
-	{
-		/**
-		 * Before UE 4.25, there is no FBasicStringFilterExpressionContext,
-		 * so define your own custom text filter.
-		 */
-		class FEnumFilterContext : public ITextFilterExpressionContext
-		{
-		public:
-			// Constructor.
-			explicit FEnumFilterContext(const FString& InStr)
-				: StrPtr(&InStr)
-			{
-			}
-
-			// ITextFilterExpressionContext interface.
-			virtual bool TestBasicStringExpression(
-				const FTextFilterString& InValue,
-				const ETextFilterTextComparisonMode InTextComparisonMode
-			) const override
-			{
-				return TextFilterUtils::TestBasicStringExpression(*StrPtr, InValue, InTextComparisonMode);
-			}
-			virtual bool TestComplexExpression(
-				const FName& InKey,
-				const FTextFilterString& InValue,
-				const ETextFilterComparisonOperation InComparisonOperation,
-				const ETextFilterTextComparisonMode InTextComparisonMode
-			) const override
-			{
-				return false;
-			}
-			// End of ITextFilterExpressionContext interface.
-
-		private:
-			const FString* StrPtr;
-		};
+	namespace SEnumViewerInternal
+	{
+		// The minimum time between refreshes for the changes made by a rebuild in progress, in seconds.
+		static constexpr double RebuildRefreshInterval = 0.5;
 	}
-	using FBasicStringFilterExpressionContext = TextFilter::FEnumFilterContext;
-#endif
 	
 	void SEnumViewer::Construct(const FArguments& InArgs, const FEnumViewerInitializationOptions& InInitOptions)
 	{
 		InitOptions = InInitOptions;
 		OnEnumPicked = InArgs._OnEnumPicked;
-		TextFilterPtr = MakeShared<FTextFilterExpressionEvaluator>(ETextFilterExpressionEvaluatorMode::BasicString);
+		TextFilterPtr = MakeShared<FTextFilterExpressionEvaluator>(ETextFilterExpressionEvaluatorMode::Complex);
 
 		// Bind the event when it needs to be refreshed.
+		FEnumRegistry::Get().RegisterViewer();
 		FEnumRegistry::Get().GetOnPopulateEnumViewer().AddSP(this, &SEnumViewer::Refresh);
+		FEnumRegistry::Get().GetOnEnumRegistryChanged().AddSP(this, &SEnumViewer::HandleOnEnumRegistryChanged);
+		FEnumRegistry::Get().GetOnPopulatingChanged().AddSP(this, &SEnumViewer::HandleOnEnumRegistryPopulatingChanged);
 		UEnumViewerSettings::OnSettingChanged().AddSP(this, &SEnumViewer::Refresh);
 
+		// The style doesn't change while the viewer is open, so look the colors up once rather than every time the button is painted.
+		ViewButtonForegroundColor = FEditorStyle::GetSlateColor(TEXT("DefaultForeground"));
+		ViewButtonHoveredForegroundColor = FEditorStyle::GetSlateColor(TEXT("InvertedForeground"));
+
 		// Create the asset discovery indicator.
 		FEditorWidgetsModule& EditorWidgetsModule = FModuleManager::LoadModuleChecked<FEditorWidgetsModule>(TEXT("EditorWidgets"));
 		const TSharedRef<SWidget> AssetDiscoveryIndicator = EditorWidgetsModule.CreateAssetDiscoveryIndicator(EAssetDiscoveryIndicatorScaleMode::Scale_Vertical);
@@ -134,6 +108,7 @@ namespace EnumViewer
 						.Padding(2.0f, 2.0f)
 						[
 							SAssignNew(SearchBox, SSearchBox)
+							.ToolTipText(LOCTEXT("SearchBoxToolTip", "Search enums by name.\nKeyed expressions can be combined with the name: Module:Engine, Path:/Game/AI, Package:/Script/Engine, Type:Native, Type:Asset, Flags:Bitmask, Flags:EnumClass, Values>32."))
 							.OnTextChanged(this, &SEnumViewer::HandleOnFilterTextChanged)
 							.OnTextCommitted(this, &SEnumViewer::HandleOnFilterTextCommitted)
 						]
@@ -185,8 +160,32 @@ namespace EnumViewer
 						.VAlign(VAlign_Center)
 						.Padding(8, 0)
 						[
-							SNew(STextBlock)
-							.Text(this, &SEnumViewer::HandleGetEnumCountText)
+							SAssignNew(EnumCountTextBlock, STextBlock)
+						]
+						// Refreshing indicator.
+						+SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(0, 0, 8, 0)
+						[
+							SAssignNew(RefreshingIndicator, SHorizontalBox)
+							.Visibility(FEnumRegistry::Get().IsPopulating() ? EVisibility::Visible : EVisibility::Collapsed)
+							.ToolTipText(LOCTEXT("RefreshingIndicatorToolTip", "The list of enums is being rebuilt. The current list is displayed until it completes."))
+							+SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							[
+								SNew(SCircularThrobber)
+								.Radius(7.0f)
+							]
+							+SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							.Padding(4, 0, 0, 0)
+							[
+								SNew(STextBlock)
+								.Text(LOCTEXT("RefreshingIndicator", "Refreshing..."))
+							]
 						]
 						// View options combo button.
 						+SHorizontalBox::Slot()
@@ -245,6 +244,7 @@ namespace EnumViewer
 		
 		bNeedsRefresh = true;
 		bPendingFocusNextFrame = true;
+		RequestUpdate();
 	}
 
 	SEnumViewer::~SEnumViewer()
@@ -252,15 +252,16 @@ namespace EnumViewer
 		if (auto* EnumRegistry = FEnumRegistry::GetPtr())
 		{
 			EnumRegistry->GetOnPopulateEnumViewer().RemoveAll(this);
+			EnumRegistry->GetOnEnumRegistryChanged().RemoveAll(this);
+			EnumRegistry->GetOnPopulatingChanged().RemoveAll(this);
+			EnumRegistry->UnregisterViewer();
 		}
 		
 		UEnumViewerSettings::OnSettingChanged().RemoveAll(this);
 	}
 
-	void SEnumViewer::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+	EActiveTimerReturnType SEnumViewer::HandleOnUpdateTimer(double InCurrentTime, float InDeltaTime)
 	{
-		SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
-		
 		// Move focus to search box
 		if (bPendingFocusNextFrame && SearchBox.IsValid())
 		{
@@ -270,11 +271,37 @@ namespace EnumViewer
 			bPendingFocusNextFrame = false;
 		}
 
+		// A search can't go on once the snapshot has changed, as the registry indices it holds may have moved.
+		// The change is normally notified first, but the search must never read the snapshot before that happens.
+		if (SearchJob.IsValid() && SearchJob->IsOutdated())
+		{
+			CancelSearch();
+			bHasDeferredRegistryChanges = true;
+		}
+
+		// While the Enum Registry is being rebuilt, the changes are picked up at intervals rather than every frame.
+		if (bHasDeferredRegistryChanges && FPlatformTime::Seconds() - LastRegistryRefreshTime >= SEnumViewerInternal::RebuildRefreshInterval)
+		{
+			RefreshForRegistryChanges();
+		}
+
 		if (bNeedsRefresh)
 		{
 			bNeedsRefresh = false;
 			Populate();
 		}
+		else if (SearchJob.IsValid())
+		{
+			if (TickSearch() && ListView.IsValid())
+			{
+				ListView->RequestListRefresh();
+			}
+			UpdateEnumCountText();
+		}
+
+		// Requests made while doing the work above are picked up by the next call.
+		const bool bHasPendingWork = (bPendingFocusNextFrame || bNeedsRefresh || bHasDeferredRegistryChanges || SearchJob.IsValid());
+		return (bHasPendingWork ? EActiveTimerReturnType::Continue : EActiveTimerReturnType::Stop);
 	}
 
 	FReply SEnumViewer::OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& InFocusEvent)
@@ -293,7 +320,6 @@ namespace EnumViewer
 	{
 		if (InitOptions.Mode == EEnumViewerMode::EnumBrowsing)
 		{
-			const TArray<TSharedPtr<FEnumViewerNode>> SelectedItems = GetSelectedItems();
 			if (SelectedItems.IsValidIndex(0))
 			{
 				const TSharedPtr<FEnumViewerNode> SelectedItem = SelectedItems[0];
@@ -318,191 +344,360 @@ namespace EnumViewer
 
 	TArray<TSharedPtr<FEnumViewerNode>> SEnumViewer::GetSelectedItems() const
 	{
-		if (ListView.IsValid())
-		{
-			return ListView->GetSelectedItems();
-		}
-
-		return {};
+		return SelectedItems;
 	}
 
 	void SEnumViewer::Refresh()
 	{
+		// Anything other than the search query may have changed, so the cached results are no longer valid.
+		CancelSearch();
+		QueryCache.Reset();
+		bOnlyFilterTextChanged = false;
+		bNeedsRowRebuild = true;
 		bNeedsRefresh = true;
+		RequestUpdate();
+
+		// The culture may have changed, so build the count label again even if the counts stay the same.
+		DisplayedNumEnums = INDEX_NONE;
+	}
+
+	void SEnumViewer::RefreshForRegistryChanges()
+	{
+		// The indices of the nodes may have changed, so the cached results are no longer valid.
+		CancelSearch();
+		QueryCache.Reset();
+		bOnlyFilterTextChanged = false;
+		bNeedsRefresh = true;
+		RequestUpdate();
+
+		bHasDeferredRegistryChanges = false;
+		LastRegistryRefreshTime = FPlatformTime::Seconds();
+	}
+
+	void SEnumViewer::RequestUpdate()
+	{
+		if (!UpdateTimerHandle.IsValid())
+		{
+			UpdateTimerHandle = RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SEnumViewer::HandleOnUpdateTimer));
+		}
 	}
 
 	void SEnumViewer::Populate()
 	{
-		EnumNodes.Empty();
+		// A search still in progress is for an outdated query or list.
+		CancelSearch();
+		
+		FEnumRegistry& EnumRegistry = FEnumRegistry::Get();
+		const FEnumRegistrySnapshotPtr& SnapshotPtr = EnumRegistry.GetSnapshotPtr();
+		const FEnumRegistrySnapshot& Snapshot = *SnapshotPtr;
+		
+		// The internal only and developer folder classifications are cached in the Enum Registry until the settings change.
+		EnumRegistry.ClassifyPaths();
 
-		const bool bShowingInternalEnums = IsShowingInternalEnums();
-		TArray<FDirectoryPath> InternalPaths;
+		// The Enum Registry keeps the nodes in order, and the search keeps the order of its candidates.
+		const TArray<int32>& SortedNodeIndices = EnumRegistry.GetSortedNodeIndices(GetCurrentSortType(), InitOptions.NameTypeToDisplay);
+		
+		// In picker mode, the list only contains the nodes that pass the filter, which are added as they are found.
+		// Otherwise, the list contains all the nodes in order and doesn't change when only the search query has changed.
+		if (InitOptions.Mode == EEnumViewerMode::EnumPicker)
+		{
+			ResetPickerList();
+		}
+		else if (!bOnlyFilterTextChanged)
+		{
+			EnumNodes.Reset(SortedNodeIndices.Num());
+			for (const int32 NodeIndex : SortedNodeIndices)
+			{
+				EnumNodes.Add(Snapshot.GetNode(NodeIndex));
+			}
+		}
+		const bool bRebuildRows = bNeedsRowRebuild;
+		bNeedsRowRebuild = false;
+		bOnlyFilterTextChanged = false;
 		
-		// If we aren't showing the internal enums, then we need to know what enums to consider Internal Only, so let's gather them up from the settings object.
-		if (!bShowingInternalEnums)
+		PassedFilterFlags.Init(false, Snapshot.Num());
+		NumShownMatches = 0;
+
+		// Reuse the result of a recent query, or narrow it down if the query extends it.
+		auto MakeSearchJob = [&](const TArray<int32>& InCandidateIndices) -> TUniquePtr<FEnumViewerSearchJob>
 		{
-			InternalPaths = GetInternalOnlyPaths();
-			TArray<TSoftObjectPtr<const UEnum>> InternalEnumNames = GetInternalOnlyEnums();
+			return MakeUnique<FEnumViewerSearchJob>(
+				SnapshotPtr,
+				InitOptions,
+				GetCurrentDeveloperViewType(),
+				IsShowingInternalEnums(),
+				TextFilterPtr,
+				InCandidateIndices
+			);
+		};
+		const FString FilterText = (TextFilterPtr.IsValid() ? TextFilterPtr->GetFilterText().ToString() : FString());
+		if (const TArray<int32>* CachedNodeIndices = QueryCache.Find(FilterText))
+		{
+			SearchJob = MakeSearchJob({});
+			SearchJob->CompleteWith(*CachedNodeIndices);
+		}
+		else
+		{
+			const TArray<int32>* RefinementBase = QueryCache.FindRefinementBase(FilterText);
+			SearchJob = MakeSearchJob(RefinementBase != nullptr ? *RefinementBase : SortedNodeIndices);
+		}
+
+		// Show the first matches in this frame rather than waiting for the next one.
+		TickSearch();
 
-			// Take the package names for the internal only enums and convert them into their UEnums
-			for (const TSoftObjectPtr<const UEnum>& InternalEnumName : InternalEnumNames)
+		// The rows read the text color and the highlight that depend on the filter from this viewer,
+		// so the rows of the nodes still in the list are kept when only the query or the nodes in the Enum Registry have changed.
+		// Added and replaced nodes are new items of the list, so the list generates rows for them.
+		if (ListView.IsValid())
+		{
+			if (bRebuildRows)
 			{
-				const TSharedPtr<FEnumViewerNode> EnumNode = FEnumRegistry::Get().FindNodeByEnumPath(*InternalEnumName.ToString());
-				if (EnumNode.IsValid())
-				{
-					FDirectoryPath DirectoryPath;
-					DirectoryPath.Path = EnumNode->GetEnumPath().ToString();
-					InternalPaths.Add(DirectoryPath);
-				}
+				ListView->RebuildList();
+			}
+			else
+			{
+				ListView->RequestListRefresh();
 			}
 		}
 
-		auto FilterPredicate = [&](const TSharedPtr<FEnumViewerNode>& EnumViewerNode) -> bool
+		UpdateEnumCountText();
+	}
+
+	bool SEnumViewer::TickSearch()
+	{
+		check(SearchJob.IsValid() && !SearchJob->IsOutdated());
+		SearchJob->Tick();
+
+		// Add the matches found in this frame to the list.
+		const FEnumRegistrySnapshot& Snapshot = SearchJob->GetSnapshot();
+		const TArray<int32>& MatchedNodeIndices = SearchJob->GetMatchedNodeIndices();
+		const bool bHasNewMatches = (NumShownMatches < MatchedNodeIndices.Num());
+		for (; NumShownMatches < MatchedNodeIndices.Num(); NumShownMatches++)
 		{
-			const FString DeveloperPathWithSlash = FPackageName::FilenameToLongPackageName(FPaths::GameDevelopersDir());
-			const FString UserDeveloperPathWithSlash = FPackageName::FilenameToLongPackageName(FPaths::GameUserDeveloperDir());
-			const FString EnumPathString = EnumViewerNode->GetEnumPath().ToString();
-			
-			// Whether you cleared the filter for developer folders.
-			bool bPassesDeveloperFilter = true;
+			const int32 NodeIndex = MatchedNodeIndices[NumShownMatches];
+			PassedFilterFlags[NodeIndex] = true;
+			if (InitOptions.Mode == EEnumViewerMode::EnumPicker)
 			{
-				const EEnumViewerDeveloperType AllowedDeveloperType = GetCurrentDeveloperViewType();
-				if (AllowedDeveloperType == EEnumViewerDeveloperType::None)
-				{
-					bPassesDeveloperFilter = !EnumPathString.StartsWith(DeveloperPathWithSlash);
-				}
-				else if (AllowedDeveloperType == EEnumViewerDeveloperType::CurrentUser)
-				{
-					if (EnumPathString.StartsWith(DeveloperPathWithSlash))
-					{
-						bPassesDeveloperFilter = EnumPathString.StartsWith(UserDeveloperPathWithSlash);
-					}
-				}
+				EnumNodes.Add(Snapshot.GetNode(NodeIndex));
 			}
-			
-			// Whether the filter for internal use only has been cleared.
-			bool bPassesInternalFilter = true;
-			if (!bShowingInternalEnums && InternalPaths.Num() > 0)
+		}
+
+		if (!SearchJob->IsComplete())
+		{
+			return bHasNewMatches;
+		}
+
+		// The cache keeps the sorted order, which refinements rely on, so rank the best matches only for display.
+		const FString FilterText = (TextFilterPtr.IsValid() ? TextFilterPtr->GetFilterText().ToString() : FString());
+		if (QueryCache.Find(FilterText) == nullptr)
+		{
+			QueryCache.Add(FilterText, MatchedNodeIndices);
+		}
+
+		const FEnumViewerFilterContext& FilterContext = SearchJob->GetFilterContext();
+		if (FilterContext.IsRankingByScore())
+		{
+			TArray<int32> RankedNodeIndices = MatchedNodeIndices;
+			FilterContext.RankNodeIndices(RankedNodeIndices);
+
+			// The full list stays in order in browsing mode, so bring the best match into view instead.
+			if (InitOptions.Mode == EEnumViewerMode::EnumPicker)
 			{
-				for (const FDirectoryPath& InternalPath : InternalPaths)
+				ResetPickerList();
+				for (const int32 NodeIndex : RankedNodeIndices)
 				{
-					if (EnumPathString.StartsWith(InternalPath.Path))
-					{
-						bPassesInternalFilter = false;
-						break;
-					}
+					EnumNodes.Add(Snapshot.GetNode(NodeIndex));
 				}
 			}
-
-			// Whether you cleared the text filter.
-			bool bPassedTextFilter = true;
-			if (TextFilterPtr.IsValid())
+			else if (RankedNodeIndices.Num() > 0 && ListView.IsValid())
 			{
-				bPassedTextFilter = TextFilterPtr->TestTextFilter(
-					FBasicStringFilterExpressionContext(EnumViewerNode->GetEnumName())
-				);
+				ListView->RequestScrollIntoView(Snapshot.GetNode(RankedNodeIndices[0]));
 			}
+		}
+
+		SearchJob.Reset();
+		return true;
+	}
+
+	void SEnumViewer::CancelSearch()
+	{
+		// The search refers to the snapshot and the text filter, so it's discarded as soon as either of them changes.
+		SearchJob.Reset();
+	}
 
-			// Whether the user-extensible filter has been cleared.
-			bool bPassedCustomFilter = false;
-			if (EnumViewerNode.IsValid())
+	void SEnumViewer::ResetPickerList()
+	{
+		EnumNodes.Reset();
+		if (InitOptions.bShowNoneOption)
+		{
+			if (!NoneNode.IsValid())
 			{
-				bPassedCustomFilter = FEnumViewerUtils::IsEnumAllowed(InitOptions, EnumViewerNode->GetEnum());
+				NoneNode = MakeShared<FEnumViewerNode>();
 			}
-			else
+			
+			EnumNodes.Add(NoneNode);
+		}
+	}
+
+	bool SEnumViewer::PassedFilter(const TSharedPtr<FEnumViewerNode>& InNode) const
+	{
+		if (!InNode.IsValid())
+		{
+			return false;
+		}
+
+		// Nodes that don't belong to the Enum Registry, such as the "None" option, are not filtered.
+		const int32 RegistryIndex = InNode->GetRegistryIndex();
+		if (RegistryIndex == INDEX_NONE)
+		{
+			return true;
+		}
+
+		return (PassedFilterFlags.IsValidIndex(RegistryIndex) && PassedFilterFlags[RegistryIndex]);
+	}
+
+	TSharedPtr<SEnumViewerRow> SEnumViewer::FindRow(const TSharedPtr<FEnumViewerNode>& InNode) const
+	{
+		if (!ListView.IsValid())
+		{
+			return nullptr;
+		}
+
+		// All the rows of the list are generated by HandleOnGenerateRow.
+		return StaticCastSharedPtr<SEnumViewerRow>(ListView->WidgetFromItem(InNode));
+	}
+
+	void SEnumViewer::UpdateSelectedItems()
+	{
+		TArray<TSharedPtr<FEnumViewerNode>> NewSelectedItems;
+		if (ListView.IsValid())
+		{
+			NewSelectedItems = ListView->GetSelectedItems();
+		}
+
+		for (const TSharedPtr<FEnumViewerNode>& SelectedItem : SelectedItems)
+		{
+			if (!NewSelectedItems.Contains(SelectedItem))
 			{
-				if (InitOptions.bShowUnloadedEnums)
+				if (const TSharedPtr<SEnumViewerRow> Row = FindRow(SelectedItem))
 				{
-					bPassedCustomFilter = FEnumViewerUtils::IsUnloadedEnumAllowed(InitOptions, EnumViewerNode->GetEnumPath());
+					Row->SetIsSelected(false);
 				}
 			}
+		}
 
-			return (
-				bPassesDeveloperFilter &&
-				bPassesInternalFilter &&
-				bPassedTextFilter &&
-				bPassedCustomFilter
-			);
-		};
-		
-		// Get the enum list, passing in certain filter options.
-		EnumNodes = FEnumRegistry::Get().GetNodeList(InitOptions.PropertyHandle, FilterPredicate);
-		
-		// In picker mode, delete the ones that did not clear the filter.
-		if (InitOptions.Mode == EEnumViewerMode::EnumPicker)
+		for (const TSharedPtr<FEnumViewerNode>& NewSelectedItem : NewSelectedItems)
 		{
-			EnumNodes.RemoveAll(
-				[](const TSharedPtr<FEnumViewerNode>& EnumViewerNode) -> bool
-				{
-					if (EnumViewerNode.IsValid())
-					{
-						return !EnumViewerNode->PassedFilter();
-					}
+			if (const TSharedPtr<SEnumViewerRow> Row = FindRow(NewSelectedItem))
+			{
+				Row->SetIsSelected(true);
+			}
+		}
 
-					return true;
-				}
-			);
+		SelectedItems = MoveTemp(NewSelectedItems);
+		UpdateRowOptionsButton();
+		UpdateEnumCountText();
+	}
+
+	void SEnumViewer::UpdateRowOptionsButton()
+	{
+		TSharedPtr<SEnumViewerRow> NewOwner = HoveredRow.Pin();
+		if (!NewOwner.IsValid() && SelectedItems.IsValidIndex(0))
+		{
+			NewOwner = FindRow(SelectedItems[0]);
 		}
-		
-		// Sort the list alphabetically.
-		EnumNodes.Sort(
-			[](const TSharedPtr<FEnumViewerNode>& Lhs, const TSharedPtr<FEnumViewerNode>& Rhs) -> bool
+
+		PlaceRowOptionsButton(NewOwner);
+	}
+
+	void SEnumViewer::PlaceRowOptionsButton(TSharedPtr<SEnumViewerRow> InRow)
+	{
+		// The options are only offered for loaded enums in browser mode.
+		if (InitOptions.Mode != EEnumViewerMode::EnumBrowsing)
+		{
+			return;
+		}
+
+		// Leave the button where it is while its menu is open, as the mouse leaves the row to use the menu.
+		if (RowOptionsButton.IsValid() && RowOptionsButton->IsOpen())
+		{
+			return;
+		}
+
+		if (InRow.IsValid())
+		{
+			const TSharedPtr<FEnumViewerNode> Node = InRow->GetAssociatedNode();
+			if (!Node.IsValid() || !IsValid(Node->GetEnum()))
 			{
-				check(Lhs.IsValid() && Rhs.IsValid());
-				
-				return (Lhs->GetEnumName() < Rhs->GetEnumName());
+				InRow.Reset();
 			}
-		);
-		
-		if (InitOptions.bShowNoneOption && InitOptions.Mode == EEnumViewerMode::EnumPicker)
+		}
+
+		const TSharedPtr<SEnumViewerRow> OldOwner = RowOptionsButtonOwner.Pin();
+		if (InRow == OldOwner)
 		{
-			EnumNodes.Insert(MakeShared<FEnumViewerNode>(), 0);
+			return;
 		}
 
-		if (ListView.IsValid())
+		if (OldOwner.IsValid())
 		{
-			ListView->RequestListRefresh();
+			OldOwner->SetOptionsButton(nullptr);
 		}
-	}
 
-	bool SEnumViewer::IsShowingInternalEnums() const
-	{
-		if (!InitOptions.bAllowViewOptions)
+		if (InRow.IsValid())
 		{
-			return true;
+			if (!RowOptionsButton.IsValid())
+			{
+				SAssignNew(RowOptionsButton, SComboButton)
+					.ContentPadding(FMargin(2.0f))
+					.OnGetMenuContent(this, &SEnumViewer::HandleGetRowOptionsMenuContent);
+			}
+
+			InRow->SetOptionsButton(RowOptionsButton);
 		}
-		
-		return UEnumViewerSettings::Get().bDisplayInternalEnums;
+
+		RowOptionsButtonOwner = InRow;
 	}
-	
-	EEnumViewerDeveloperType SEnumViewer::GetCurrentDeveloperViewType() const
+
+	void SEnumViewer::HandleOnEnumRegistryChanged(const FEnumRegistryDelta& InDelta)
 	{
-		if (!InitOptions.bAllowViewOptions)
+		if (InDelta.IsEmpty())
 		{
-			return EEnumViewerDeveloperType::All;
+			return;
 		}
 
-		return UEnumViewerSettings::Get().DeveloperFolderType;
+		// The search holds registry indices of the snapshot as it was, so it's discarded even if the refresh is deferred.
+		CancelSearch();
+
+		// A time-sliced rebuild notifies its changes every frame, and populating the list that often would stall the editor.
+		if (FEnumRegistry::Get().IsPopulating())
+		{
+			bHasDeferredRegistryChanges = true;
+			RequestUpdate();
+			return;
+		}
+
+		RefreshForRegistryChanges();
 	}
 
-	TArray<TSoftObjectPtr<const UEnum>> SEnumViewer::GetInternalOnlyEnums() const
+	bool SEnumViewer::IsShowingInternalEnums() const
 	{
 		if (!InitOptions.bAllowViewOptions)
 		{
-			return {};
+			return true;
 		}
 		
-		return UEnumViewerProjectSettings::Get().InternalOnlyEnums;
+		return UEnumViewerSettings::Get().bDisplayInternalEnums;
 	}
-
-	TArray<FDirectoryPath> SEnumViewer::GetInternalOnlyPaths() const
+	
+	EEnumViewerDeveloperType SEnumViewer::GetCurrentDeveloperViewType() const
 	{
 		if (!InitOptions.bAllowViewOptions)
 		{
-			return {};
+			return EEnumViewerDeveloperType::All;
 		}
-		
-		return UEnumViewerProjectSettings::Get().InternalOnlyPaths;
+
+		return UEnumViewerSettings::Get().DeveloperFolderType;
 	}
 
 	void SEnumViewer::ToggleShowInternalEnums()
@@ -525,11 +720,37 @@ namespace EnumViewer
 		}
 	}
 
+	EEnumViewerSortType SEnumViewer::GetCurrentSortType() const
+	{
+		if (!InitOptions.bAllowViewOptions)
+		{
+			return EEnumViewerSortType::Name;
+		}
+
+		return UEnumViewerSettings::Get().SortType;
+	}
+
+	bool SEnumViewer::IsCurrentSortType(EEnumViewerSortType SortType) const
+	{
+		return (GetCurrentSortType() == SortType);
+	}
+
+	void SEnumViewer::SetCurrentSortType(EEnumViewerSortType NewType)
+	{
+		if (ensure(NewType < EEnumViewerSortType::Max) &&
+			NewType != UEnumViewerSettings::Get().SortType)
+		{
+			FEnumViewerSettingsModifier::SetSortType(NewType);
+		}
+	}
+
 	void SEnumViewer::HandleOnFilterTextChanged(const FText& InFilterText)
 	{
 		if (TextFilterPtr.IsValid())
 		{
+			CancelSearch();
 			TextFilterPtr->SetFilterText(InFilterText);
+			HighlightText = InFilterText;
 
 			if (SearchBox.IsValid())
 			{
@@ -537,7 +758,13 @@ namespace EnumViewer
 			}
 		}
 
-		Refresh();
+		// Keep the cached results, unless a full refresh is already pending.
+		if (!bNeedsRefresh)
+		{
+			bOnlyFilterTextChanged = true;
+		}
+		bNeedsRefresh = true;
+		RequestUpdate();
 	}
 
 	void SEnumViewer::HandleOnFilterTextCommitted(const FText& InText, ETextCommit::Type CommitInfo)
@@ -560,8 +787,9 @@ namespace EnumViewer
 					}
 
 					// Check if the item passes the filter, parent items might be displayed but filtered out and thus not desired to be selected.
-					if (Enum && FirstSelected->PassedFilter())
+					if (Enum && PassedFilter(FirstSelected))
 					{
+						FEnumRegistry::Get().NotifyEnumPicked(FirstSelected->GetEnumPath());
 						OnEnumPicked.ExecuteIfBound(Enum);
 					}
 				}
@@ -569,27 +797,59 @@ namespace EnumViewer
 		}
 	}
 
-	FText SEnumViewer::HandleGetEnumCountText() const
+	void SEnumViewer::UpdateEnumCountText()
 	{
 		const int32 NumOfEnums = EnumNodes.Num();
-		const int32 NumOfSelectedEnums = GetSelectedItems().Num();
-		if (NumOfSelectedEnums == 0)
+		const int32 NumOfSelectedEnums = SelectedItems.Num();
+		const bool bIsSearching = SearchJob.IsValid();
+		if (NumOfEnums == DisplayedNumEnums &&
+			NumOfSelectedEnums == DisplayedNumSelectedEnums &&
+			bIsSearching == bDisplayedSearching)
+		{
+			return;
+		}
+
+		DisplayedNumEnums = NumOfEnums;
+		DisplayedNumSelectedEnums = NumOfSelectedEnums;
+		bDisplayedSearching = bIsSearching;
+
+		FText EnumCountText;
+		if (bIsSearching)
+		{
+			EnumCountText = FText::Format(LOCTEXT("EnumCountLabelSearching", "{0} {0}|plural(one=item,other=items) (searching...)"), NumOfEnums);
+		}
+		else if (NumOfSelectedEnums == 0)
 		{
-			return FText::Format(LOCTEXT("EnumCountLabel", "{0} {0}|plural(one=item,other=items)"), NumOfEnums);
+			EnumCountText = FText::Format(LOCTEXT("EnumCountLabel", "{0} {0}|plural(one=item,other=items)"), NumOfEnums);
 		}
 		else
 		{
-			return FText::Format(LOCTEXT("EnumCountLabelPlusSelection", "{0} {0}|plural(one=item,other=items) ({1} selected)"), NumOfEnums, NumOfSelectedEnums);
+			EnumCountText = FText::Format(LOCTEXT("EnumCountLabelPlusSelection", "{0} {0}|plural(one=item,other=items) ({1} selected)"), NumOfEnums, NumOfSelectedEnums);
+		}
+
+		if (EnumCountTextBlock.IsValid())
+		{
+			EnumCountTextBlock->SetText(EnumCountText);
+		}
+	}
+
+	void SEnumViewer::HandleOnEnumRegistryPopulatingChanged(bool bIsPopulating)
+	{
+		if (RefreshingIndicator.IsValid())
+		{
+			RefreshingIndicator->SetVisibility(bIsPopulating ? EVisibility::Visible : EVisibility::Collapsed);
+		}
+
+		// Show the result of the rebuild without waiting for the next interval.
+		if (!bIsPopulating && bHasDeferredRegistryChanges)
+		{
+			RefreshForRegistryChanges();
 		}
 	}
 
 	FSlateColor SEnumViewer::HandleGetViewButtonForegroundColor() const
 	{
-		return (
-			ViewOptionsComboButton->IsHovered() ?
-			FEditorStyle::GetSlateColor(TEXT("InvertedForeground")) :
-			FEditorStyle::GetSlateColor(TEXT("DefaultForeground"))
-		);
+		return (ViewOptionsComboButton->IsHovered() ? ViewButtonHoveredForegroundColor : ViewButtonForegroundColor);
 	}
 
 	TSharedRef<SWidget> SEnumViewer::HandleGetViewButtonContent()
@@ -656,12 +916,80 @@ namespace EnumViewer
 		}
 		MenuBuilder.EndSection();
 
+		MenuBuilder.BeginSection(TEXT("SortType"), LOCTEXT("SortTypeHeading", "Sort By"));
+		{
+			MenuBuilder.AddMenuEntry(
+				LOCTEXT("NameSortOption", "Name"),
+				LOCTEXT("NameSortOptionToolTip", "List enums alphabetically by enum name."),
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateSP(this, &SEnumViewer::SetCurrentSortType, EEnumViewerSortType::Name),
+					FCanExecuteAction(),
+					FIsActionChecked::CreateSP(this, &SEnumViewer::IsCurrentSortType, EEnumViewerSortType::Name)
+				),
+				NAME_None,
+				EUserInterfaceActionType::RadioButton
+			);
+
+			MenuBuilder.AddMenuEntry(
+				LOCTEXT("DisplayNameSortOption", "Display Name"),
+				LOCTEXT("DisplayNameSortOptionToolTip", "List enums alphabetically by display name."),
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateSP(this, &SEnumViewer::SetCurrentSortType, EEnumViewerSortType::DisplayName),
+					FCanExecuteAction(),
+					FIsActionChecked::CreateSP(this, &SEnumViewer::IsCurrentSortType, EEnumViewerSortType::DisplayName)
+				),
+				NAME_None,
+				EUserInterfaceActionType::RadioButton
+			);
+
+			MenuBuilder.AddMenuEntry(
+				LOCTEXT("ModuleSortOption", "Module"),
+				LOCTEXT("ModuleSortOptionToolTip", "List enums by the module or content folder that contains them."),
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateSP(this, &SEnumViewer::SetCurrentSortType, EEnumViewerSortType::Module),
+					FCanExecuteAction(),
+					FIsActionChecked::CreateSP(this, &SEnumViewer::IsCurrentSortType, EEnumViewerSortType::Module)
+				),
+				NAME_None,
+				EUserInterfaceActionType::RadioButton
+			);
+
+			MenuBuilder.AddMenuEntry(
+				LOCTEXT("NumValuesSortOption", "Number of Values"),
+				LOCTEXT("NumValuesSortOptionToolTip", "List enums with the fewest values first. Enums that are not loaded come last."),
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateSP(this, &SEnumViewer::SetCurrentSortType, EEnumViewerSortType::NumValues),
+					FCanExecuteAction(),
+					FIsActionChecked::CreateSP(this, &SEnumViewer::IsCurrentSortType, EEnumViewerSortType::NumValues)
+				),
+				NAME_None,
+				EUserInterfaceActionType::RadioButton
+			);
+
+			MenuBuilder.AddMenuEntry(
+				LOCTEXT("LastPickedSortOption", "Recently Picked"),
+				LOCTEXT("LastPickedSortOptionToolTip", "List the enums picked most recently in this session first."),
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateSP(this, &SEnumViewer::SetCurrentSortType, EEnumViewerSortType::LastPicked),
+					FCanExecuteAction(),
+					FIsActionChecked::CreateSP(this, &SEnumViewer::IsCurrentSortType, EEnumViewerSortType::LastPicked)
+				),
+				NAME_None,
+				EUserInterfaceActionType::RadioButton
+			);
+		}
+		MenuBuilder.EndSection();
+
 		return MenuBuilder.MakeWidget();
 	}
 
 	TSharedPtr<SWidget> SEnumViewer::HandleOnContextMenuOpening()
 	{
-		TArray<TSharedPtr<FEnumViewerNode>> SelectedItems = GetSelectedItems();
 		if (SelectedItems.IsValidIndex(0))
 		{
 			const TSharedPtr<FEnumViewerNode> SelectedItem = SelectedItems[0];
@@ -683,29 +1011,86 @@ namespace EnumViewer
 		return SNullWidget::NullWidget;
 	}
 
+	TSharedRef<SWidget> SEnumViewer::HandleGetRowOptionsMenuContent()
+	{
+		if (const TSharedPtr<SEnumViewerRow> Owner = RowOptionsButtonOwner.Pin())
+		{
+			const TSharedPtr<FEnumViewerNode> Node = Owner->GetAssociatedNode();
+			if (Node.IsValid())
+			{
+				if (const UEnum* Enum = Node->GetEnum())
+				{
+					return FEnumViewerUtils::GenerateContextMenuWidget(Enum);
+				}
+			}
+		}
+
+		return SNullWidget::NullWidget;
+	}
+
+	void SEnumViewer::HandleOnRowHoveredChanged(const TSharedRef<SEnumViewerRow>& InRow, bool bIsHovered)
+	{
+		if (bIsHovered)
+		{
+			HoveredRow = InRow;
+		}
+		else if (HoveredRow.Pin() == InRow)
+		{
+			HoveredRow.Reset();
+		}
+
+		UpdateRowOptionsButton();
+	}
+
+	FText SEnumViewer::HandleGetRowHighlightText() const
+	{
+		return HighlightText;
+	}
+
+	FSlateColor SEnumViewer::HandleGetRowTextColor(TSharedPtr<FEnumViewerNode> InNode) const
+	{
+		return FLinearColor(1.0f, 1.0f, 1.0f, (PassedFilter(InNode) ? 1.0f : 0.5f));
+	}
+
 	TSharedRef<ITableRow> SEnumViewer::HandleOnGenerateRow(
 		TSharedPtr<FEnumViewerNode> Item,
 		const TSharedRef<STableViewBase>& OwnerTable
 	)
 	{
-		return SNew(SEnumViewerRow, OwnerTable)
+		// The rows are kept by the list while their nodes stay in it,
+		// so anything that changes with the filter is read through attributes rather than copied into them.
+		const bool bIsSelected = SelectedItems.Contains(Item);
+		const TSharedRef<SEnumViewerRow> Row = SNew(SEnumViewerRow, OwnerTable)
 			.EnumDisplayName(Item->GetEnumDisplayName(InitOptions.NameTypeToDisplay))
-			.HighlightText(SearchBox->GetText())
-			.TextColor(FLinearColor(1.0f, 1.0f, 1.0f, (Item->PassedFilter() ? 1.0f : 0.5f)))
+			.HighlightText(this, &SEnumViewer::HandleGetRowHighlightText)
+			.TextColor(this, &SEnumViewer::HandleGetRowTextColor, Item)
+			.bIsSelected(bIsSelected)
 			.AssociatedNode(Item)
+			.PropertyHandle(InitOptions.PropertyHandle)
 			.bIsInEnumViewer(InitOptions.Mode == EEnumViewerMode::EnumBrowsing)
 			.bDynamicEnumLoading(InitOptions.bEnableEnumDynamicLoading)
+			.OnHoveredChanged(SEnumViewerRow::FOnHoveredChanged::CreateSP(this, &SEnumViewer::HandleOnRowHoveredChanged))
 			.OnDragDetected(this, &SEnumViewer::OnDragDetected);
+
+		// The row of the selected node may have been scrolled out of view and generated again.
+		if (bIsSelected && !HoveredRow.IsValid())
+		{
+			PlaceRowOptionsButton(Row);
+		}
+
+		return Row;
 	}
 
 	void SEnumViewer::HandleOnSelectionChanged(TSharedPtr<FEnumViewerNode> Item, ESelectInfo::Type SelectInfo)
 	{
+		UpdateSelectedItems();
+
 		if (SelectInfo == ESelectInfo::OnNavigation)
 		{
 			return;
 		}
 		
-		if (!Item.IsValid() || Item->IsRestricted())
+		if (!Item.IsValid() || Item->IsRestricted(InitOptions.PropertyHandle))
 		{
 			return;
 		}
@@ -713,6 +1098,7 @@ namespace EnumViewer
 		if (InitOptions.Mode == EEnumViewerMode::EnumPicker)
 		{
 			Item->LoadEnum();
+			FEnumRegistry::Get().NotifyEnumPicked(Item->GetEnumPath());
 			OnEnumPicked.ExecuteIfBound(Item->GetEnum());
 		}
 	}
@@ -6,13 +6,20 @@
 #include "Widgets/SCompoundWidget.h"
 #include "EnumViewer/IEnumViewer.h"
 #include "EnumViewer/Types/EnumViewerInitializationOptions.h"
+#include "EnumViewer/Data/EnumViewerQueryCache.h"
+#include "EnumViewer/Data/EnumViewerSearchJob.h"
 
 class FTextFilterExpressionEvaluator;
+class FActiveTimerHandle;
+class STextBlock;
 enum class EEnumViewerDeveloperType : uint8;
+enum class EEnumViewerSortType : uint8;
 
 namespace EnumViewer
 {
 	class FEnumViewerNode;
+	class SEnumViewerRow;
+	struct FEnumRegistryDelta;
 	
 	/**
 	 * Widget class for enum browser and enum picker.
@@ -36,7 +43,6 @@ namespace EnumViewer
 		virtual ~SEnumViewer() override;
 
 		// SWidget interface.
-		virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
 		virtual FReply OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& InFocusEvent) override;
 		virtual bool SupportsKeyboardFocus() const override;
 		virtual FReply OnDragDetected(const FGeometry& Geometry, const FPointerEvent& PointerEvent) override;
@@ -49,21 +55,54 @@ namespace EnumViewer
 		// Sends a requests to the Enum Viewer to refresh itself the next chance it gets. 
 		void Refresh();
 
+		// Requests a refresh for the nodes added to or removed from the Enum Registry.
+		// Unlike Refresh, the rows of the nodes that remain in the list are kept.
+		void RefreshForRegistryChanges();
+
+		// Registers the active timer that does the pending work of the viewer, unless it's already registered.
+		// The viewer has no work to do every frame, so the timer only runs while there is some.
+		void RequestUpdate();
+
+		// Called by the active timer to move the focus, refresh the list or advance the search.
+		EActiveTimerReturnType HandleOnUpdateTimer(double InCurrentTime, float InDeltaTime);
+
 		// Populates the list with items based on the current filter. 
 		void Populate();
 
+		// Advances the search started by Populate and adds the matches found in this frame to the list.
+		// Returns whether the list has changed.
+		bool TickSearch();
+
+		// Discards the search in progress, if any.
+		void CancelSearch();
+
+		// Clears the list in picker mode, leaving only the "None" option if it's shown.
+		void ResetPickerList();
+
+		// Returns whether the node passed the filter the last time the list was populated.
+		bool PassedFilter(const TSharedPtr<FEnumViewerNode>& InNode) const;
+
+		// Returns the row currently generated for the node, if any.
+		TSharedPtr<SEnumViewerRow> FindRow(const TSharedPtr<FEnumViewerNode>& InNode) const;
+
+		// Caches the selection of the list and tells the rows whose selection state has changed.
+		void UpdateSelectedItems();
+
+		// Moves the shared options button to the hovered row, or to the selected row if no row is hovered.
+		void UpdateRowOptionsButton();
+
+		// Moves the shared options button to the specified row, or removes it if the row is null or its enum isn't loaded.
+		void PlaceRowOptionsButton(TSharedPtr<SEnumViewerRow> InRow);
+
+		// Called when some nodes are added to or removed from the Enum Registry.
+		void HandleOnEnumRegistryChanged(const FEnumRegistryDelta& InDelta);
+
 		// Returns whether or not it's possible to show internal use enums. 
 		bool IsShowingInternalEnums() const;
 		
 		// Returns the current view type.
 		EEnumViewerDeveloperType GetCurrentDeveloperViewType() const;
 		
-		// Returns a list of enum names marked as internal only in the settings.
-		TArray<TSoftObjectPtr<const UEnum>> GetInternalOnlyEnums() const;
-
-		// Returns a list of enumerated paths marked as internal only in the settings.
-		TArray<FDirectoryPath> GetInternalOnlyPaths() const;
-
 		// Toggle whether internal use enums should be shown or not. 
 		void ToggleShowInternalEnums();
 		
@@ -72,6 +111,15 @@ namespace EnumViewer
 
 		// Sets the view type and updates lists accordingly. 
 		void SetCurrentDeveloperViewType(EEnumViewerDeveloperType NewType);
+
+		// Returns the current sort type.
+		EEnumViewerSortType GetCurrentSortType() const;
+
+		// Returns true if SortType is the current sort type.
+		bool IsCurrentSortType(EEnumViewerSortType SortType) const;
+
+		// Sets the sort type and updates lists accordingly.
+		void SetCurrentSortType(EEnumViewerSortType NewType);
 		
 		// Called by Slate when the filter box changes text. 
 		void HandleOnFilterTextChanged(const FText& InFilterText);
@@ -79,8 +127,11 @@ namespace EnumViewer
 		// Called when enter is hit in search box. 
 		void HandleOnFilterTextCommitted(const FText& InText, ETextCommit::Type CommitInfo);
 		
-		// Called when the text of an enumerated count label is constructed.
-		FText HandleGetEnumCountText() const;
+		// Updates the text of the enumerated count label if the number of items, the selection or the search state has changed.
+		void UpdateEnumCountText();
+
+		// Called when the Enum Registry starts or finishes being rebuilt.
+		void HandleOnEnumRegistryPopulatingChanged(bool bIsPopulating);
 
 		// Called when building the foreground color of the display options combo button.
 		FSlateColor HandleGetViewButtonForegroundColor() const;
@@ -90,6 +141,18 @@ namespace EnumViewer
 		
 		// Called when the context menu for the selected row is opened.
 		TSharedPtr<SWidget> HandleOnContextMenuOpening();
+
+		// Called when the options button shared by the rows is opened.
+		TSharedRef<SWidget> HandleGetRowOptionsMenuContent();
+
+		// Called when the mouse enters or leaves a row.
+		void HandleOnRowHoveredChanged(const TSharedRef<SEnumViewerRow>& InRow, bool bIsHovered);
+
+		// Called when building the text highlighted in the rows.
+		FText HandleGetRowHighlightText() const;
+
+		// Called when building the text color of the row for the node.
+		FSlateColor HandleGetRowTextColor(TSharedPtr<FEnumViewerNode> InNode) const;
 		
 		// Called when creating a widget for a row in a list.
 		TSharedRef<ITableRow> HandleOnGenerateRow(
@@ -111,7 +174,20 @@ namespace EnumViewer
 		TSharedPtr<FTextFilterExpressionEvaluator> TextFilterPtr;
 
 		// A list of enum nodes to display in this enum viewer.
+		// The nodes are shared with the Enum Registry and are not copied for each viewer.
 		TArray<TSharedPtr<FEnumViewerNode>> EnumNodes;
+
+		// Whether each node passed the filter, indexed by the registry index of the node.
+		TBitArray<> PassedFilterFlags;
+
+		// The search for the current query, while it's in progress.
+		TUniquePtr<FEnumViewerSearchJob> SearchJob;
+
+		// The number of matches of the search that have been added to the list.
+		int32 NumShownMatches = 0;
+
+		// The node that represents the "None" option.
+		TSharedPtr<FEnumViewerNode> NoneNode;
 		
 		// An instance of the list view widget used within the enum viewer.
 		TSharedPtr<SListView<TSharedPtr<FEnumViewerNode>>> ListView;
@@ -122,6 +198,54 @@ namespace EnumViewer
 		// An instance of the options combo button widget.
 		TSharedPtr<SComboButton> ViewOptionsComboButton;
 
+		// The foreground colors of the options combo button, looked up from the editor style once.
+		FSlateColor ViewButtonForegroundColor;
+		FSlateColor ViewButtonHoveredForegroundColor;
+
+		// An instance of the text block that shows the enumerated count.
+		TSharedPtr<STextBlock> EnumCountTextBlock;
+
+		// An instance of the indicator shown while the Enum Registry is being refreshed.
+		TSharedPtr<SWidget> RefreshingIndicator;
+
+		// The values the enumerated count label was last built from, so that it's only rebuilt when they change.
+		int32 DisplayedNumEnums = INDEX_NONE;
+		int32 DisplayedNumSelectedEnums = INDEX_NONE;
+		bool bDisplayedSearching = false;
+
+		// The active timer that does the pending work of the viewer, while it's registered.
+		TWeakPtr<FActiveTimerHandle> UpdateTimerHandle;
+
+		// The options combo button shared by the rows, created when it's first shown.
+		TSharedPtr<SComboButton> RowOptionsButton;
+
+		// The row that the shared options button is currently placed in.
+		TWeakPtr<SEnumViewerRow> RowOptionsButtonOwner;
+
+		// The row currently under the mouse.
+		TWeakPtr<SEnumViewerRow> HoveredRow;
+
+		// The nodes selected in the list, cached when the selection changes.
+		TArray<TSharedPtr<FEnumViewerNode>> SelectedItems;
+
+		// The text highlighted in the rows, which is the current search query.
+		FText HighlightText;
+
+		// The recent search queries and the nodes that passed the filter for them.
+		FEnumViewerQueryCache QueryCache;
+
+		// Whether only the search query has changed since the list was last populated.
+		bool bOnlyFilterTextChanged = false;
+
+		// Whether the rows need to be generated again the next time the list is populated.
+		bool bNeedsRowRebuild = false;
+
+		// Whether the Enum Registry has changed during a rebuild since the list was last refreshed for its changes.
+		bool bHasDeferredRegistryChanges = false;
+
+		// The time the list was last refreshed for the changes of the Enum Registry.
+		double LastRegistryRefreshTime = 0.0;
+		
 		// Whether the enum viewer needs to be reconfigured at the next appropriate time.
 		// A refresh is required every time an enum is added, deleted, renamed, and so on.
 		bool bNeedsRefresh = false;
@@ -7,7 +7,6 @@
 #include "IDocumentation.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/Text/STextBlock.h"
-#include "Widgets/Input/SComboButton.h"
 
 namespace EnumViewer
 {
@@ -16,19 +15,23 @@ namespace EnumViewer
 		EnumDisplayName = InArgs._EnumDisplayName;
 		bIsInEnumBrowser = InArgs._bIsInEnumViewer;
 		bDynamicEnumLoading = InArgs._bDynamicEnumLoading;
+		bIsSelected = InArgs._bIsSelected;
 		TextColor = InArgs._TextColor;
 		AssociatedNode = InArgs._AssociatedNode;
+		PropertyHandle = InArgs._PropertyHandle;
 		OnDoubleClicked = InArgs._OnDoubleClicked;
+		OnHoveredChanged = InArgs._OnHoveredChanged;
 		
 		bool bIsRestricted = false;
 		if (AssociatedNode.IsValid())
 		{
-			bIsRestricted = AssociatedNode->IsRestricted();
+			bIsRestricted = AssociatedNode->IsRestricted(PropertyHandle);
 		}
 		
+		// The options button and the tooltip are not created for each row, as most rows are only scrolled past.
 		ChildSlot
 		[
-			SNew(SHorizontalBox)
+			SAssignNew(ContentBox, SHorizontalBox)
 			+SHorizontalBox::Slot()
 			.FillWidth(1.0f)
 			.Padding(0.0f, 3.0f, 6.0f, 3.0f)
@@ -38,20 +41,8 @@ namespace EnumViewer
 				.Text(EnumDisplayName)
 				.HighlightText(InArgs._HighlightText)
 				.ColorAndOpacity(this, &SEnumViewerRow::GetTextColor)
-				.ToolTip(GetTextTooltip())
 				.IsEnabled(!bIsRestricted)
 			]
-			+SHorizontalBox::Slot()
-			.AutoWidth()
-			.HAlign(HAlign_Right)
-			.VAlign(VAlign_Center)
-			.Padding(0.0f, 0.0f, 6.0f, 0.0f)
-			[
-				SNew(SComboButton)
-				.ContentPadding(FMargin(2.0f))
-				.Visibility(this, &SEnumViewerRow::GetOptionsVisibility)
-				.OnGetMenuContent(this, &SEnumViewerRow::GenerateOptionsMenu)
-			]
 		];
 
 		ConstructInternal(
@@ -62,6 +53,53 @@ namespace EnumViewer
 		);
 	}
 
+	TSharedPtr<FEnumViewerNode> SEnumViewerRow::GetAssociatedNode() const
+	{
+		return AssociatedNode;
+	}
+
+	void SEnumViewerRow::SetIsSelected(const bool bInIsSelected)
+	{
+		bIsSelected = bInIsSelected;
+	}
+
+	void SEnumViewerRow::SetOptionsButton(const TSharedPtr<SWidget>& InOptionsButton)
+	{
+		if (OptionsButton == InOptionsButton)
+		{
+			return;
+		}
+
+		if (OptionsButton.IsValid())
+		{
+			ContentBox->RemoveSlot(OptionsButton.ToSharedRef());
+		}
+
+		OptionsButton = InOptionsButton;
+		if (OptionsButton.IsValid())
+		{
+			ContentBox->AddSlot()
+			.AutoWidth()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Center)
+			.Padding(0.0f, 0.0f, 6.0f, 0.0f)
+			[
+				OptionsButton.ToSharedRef()
+			];
+		}
+	}
+
+	TSharedPtr<IToolTip> SEnumViewerRow::GetToolTip()
+	{
+		if (!bTextToolTipCreated)
+		{
+			TextToolTip = GetTextTooltip();
+			bTextToolTipCreated = true;
+		}
+
+		return TextToolTip;
+	}
+
 	FReply SEnumViewerRow::OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent)
 	{
 		if (bIsInEnumBrowser)
@@ -72,6 +110,9 @@ namespace EnumViewer
 				if (bDynamicEnumLoading && InMouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
 				{
 					AssociatedNode->LoadEnum();
+
+					// Let the owner's enum viewer show the options button now that the enum is loaded.
+					OnHoveredChanged.ExecuteIfBound(SharedThis(this), IsHovered());
 				}
 
 				// If there is a enum asset, open its asset editor; otherwise try to open the enum header.
@@ -93,24 +134,35 @@ namespace EnumViewer
 		return FReply::Handled();
 	}
 
+	void SEnumViewerRow::OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+	{
+		STableRow::OnMouseEnter(MyGeometry, MouseEvent);
+
+		OnHoveredChanged.ExecuteIfBound(SharedThis(this), true);
+	}
+
+	void SEnumViewerRow::OnMouseLeave(const FPointerEvent& MouseEvent)
+	{
+		STableRow::OnMouseLeave(MouseEvent);
+
+		OnHoveredChanged.ExecuteIfBound(SharedThis(this), false);
+	}
+
 	FSlateColor SEnumViewerRow::GetTextColor() const
 	{
-		const TSharedPtr<ITypedTableView<TSharedPtr<FString>>> OwnerWidget = OwnerTablePtr.Pin();
-		const TSharedPtr<FString>* Item = OwnerWidget->Private_ItemFromWidget(this);
-		if (OwnerWidget->Private_IsItemSelected(*Item))
+		if (bIsSelected)
 		{
 			return FSlateColor::UseForeground();
 		}
 
-		return TextColor;
+		return TextColor.Get();
 	}
 
 	TSharedPtr<IToolTip> SEnumViewerRow::GetTextTooltip() const
 	{
-		TSharedPtr<IToolTip> TextToolTip;
+		TSharedPtr<IToolTip> NewToolTip;
 
-		const TSharedPtr<IPropertyHandle> PropertyHandle = AssociatedNode->GetPropertyHandle();
-		if (PropertyHandle && AssociatedNode->IsRestricted())
+		if (PropertyHandle && AssociatedNode->IsRestricted(PropertyHandle))
 		{
 			FText RestrictionToolTip;
 			PropertyHandle->GenerateRestrictionToolTip(
@@ -118,7 +170,7 @@ namespace EnumViewer
 				RestrictionToolTip
 			);
 
-			TextToolTip = IDocumentation::Get()->CreateToolTip(
+			NewToolTip = IDocumentation::Get()->CreateToolTip(
 				RestrictionToolTip,
 				nullptr,
 				{},
@@ -127,36 +179,10 @@ namespace EnumViewer
 		}
 		else if (!AssociatedNode->GetEnumPath().IsNone())
 		{
-			TextToolTip = SNew(SToolTip)
+			NewToolTip = SNew(SToolTip)
 				.Text(FText::FromName(AssociatedNode->GetEnumPath()));
 		}
 
-		return TextToolTip;
-	}
-
-	EVisibility SEnumViewerRow::GetOptionsVisibility() const
-	{
-		if (bIsInEnumBrowser)
-		{
-			if (AssociatedNode.IsValid() && IsValid(AssociatedNode->GetEnum()))
-			{
-				return EVisibility::Visible;
-			}
-		}
-
-		return EVisibility::Collapsed;
-	}
-
-	TSharedRef<SWidget> SEnumViewerRow::GenerateOptionsMenu() const
-	{
-		if (AssociatedNode.IsValid())
-		{
-			if (const UEnum* Enum = AssociatedNode->GetEnum())
-			{
-				return FEnumViewerUtils::GenerateContextMenuWidget(Enum);
-			}
-		}
-
-		return SNullWidget::NullWidget;
+		return NewToolTip;
 	}
 }
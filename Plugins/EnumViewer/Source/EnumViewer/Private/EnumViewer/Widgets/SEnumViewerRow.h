@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "Widgets/Views/STableRow.h"
 
+class IPropertyHandle;
+class SHorizontalBox;
+
 namespace EnumViewer
 {
 	class FEnumViewerNode;
@@ -17,12 +20,16 @@ namespace EnumViewer
 	public:
 		// Defines an event to be called when the enum line indicated by this widget is double-clicked.
 		DECLARE_DELEGATE_OneParam(FOnDoubleCliced, TSharedPtr<FEnumViewerNode>);
+
+		// Defines an event to be called when the mouse enters or leaves this widget.
+		DECLARE_DELEGATE_TwoParams(FOnHoveredChanged, const TSharedRef<SEnumViewerRow>& /* Row */, bool /* bIsHovered */);
 		
 	public:
 		SLATE_BEGIN_ARGS(SEnumViewerRow)
 			: _EnumDisplayName(FText::GetEmpty())
 			, _bIsInEnumViewer(true)
 			, _bDynamicEnumLoading(true)
+			, _bIsSelected(false)
 			, _HighlightText(FText::GetEmpty())
 			, _TextColor(FLinearColor::White)
 		{
@@ -36,18 +43,27 @@ namespace EnumViewer
 		
 		// Whether dynamic enum loading is allowed.
 		SLATE_ARGUMENT(bool, bDynamicEnumLoading)
+
+		// Whether this item is selected when the row is created.
+		SLATE_ARGUMENT(bool, bIsSelected)
 		
 		/** The text this item should highlight, if any. */
-		SLATE_ARGUMENT(FText, HighlightText)
+		SLATE_ATTRIBUTE(FText, HighlightText)
 		
-		// The text color for this item.
-		SLATE_ARGUMENT(FSlateColor, TextColor)
+		// The text color for this item while it's not selected.
+		SLATE_ATTRIBUTE(FSlateColor, TextColor)
 		
 		// The enum viewer node with which this item is associated.
 		SLATE_ARGUMENT(TSharedPtr<FEnumViewerNode>, AssociatedNode)
+
+		// The property the owner's enum viewer is working on.
+		SLATE_ARGUMENT(TSharedPtr<IPropertyHandle>, PropertyHandle)
 		
 		// Called when the enum line indicated by this widget is double-clicked.
 		SLATE_ARGUMENT(FOnDoubleCliced, OnDoubleClicked)
+
+		// Called when the mouse enters or leaves this row.
+		SLATE_ARGUMENT(FOnHoveredChanged, OnHoveredChanged)
 		
 		// Called when this row is dragged.
 		SLATE_EVENT(FOnDragDetected, OnDragDetected)
@@ -57,9 +73,25 @@ namespace EnumViewer
 		// Constructor.
 		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
 
+		// Returns the enum viewer node with which this item is associated.
+		TSharedPtr<FEnumViewerNode> GetAssociatedNode() const;
+
+		// Sets whether this item is selected. The owner's enum viewer calls this when the selection changes.
+		void SetIsSelected(const bool bInIsSelected);
+
+		// Places the options button shared by the rows of the owner's enum viewer at the end of this row.
+		// Passing null removes the button placed last.
+		void SetOptionsButton(const TSharedPtr<SWidget>& InOptionsButton);
+
+		// SWidget interface.
+		virtual TSharedPtr<IToolTip> GetToolTip() override;
+		// End of SWidget interface.
+
 	private:
 		// SWidget interface.
 		virtual FReply OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent) override;
+		virtual void OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+		virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
 		// End of SWidget interface.
 
 		// Returns the text color for the item based on if it is selected or not.
@@ -68,12 +100,6 @@ namespace EnumViewer
 		// Returns a tooltip for the enum in this row.
 		TSharedPtr<IToolTip> GetTextTooltip() const;
 		
-		// Returns the visibility of the optional combo button.
-		EVisibility GetOptionsVisibility() const;
-
-		// Generates the drop down menu of options for this enum.
-		TSharedRef<SWidget> GenerateOptionsMenu() const;
-		
 	private:
 		// The name of the enum to which this item is associated.
 		FText EnumDisplayName;
@@ -84,13 +110,34 @@ namespace EnumViewer
 		// Whether dynamic enum loading is allowed.
 		bool bDynamicEnumLoading = false;
 
-		// The text color for this item.
-		FSlateColor TextColor;
+		// Whether this item is selected.
+		bool bIsSelected = false;
+
+		// The text color for this item while it's not selected.
+		TAttribute<FSlateColor> TextColor;
+
+		// The tooltip for the enum in this row, created when it's first shown.
+		TSharedPtr<IToolTip> TextToolTip;
+
+		// Whether the tooltip has been created, as there may be none to show.
+		bool bTextToolTipCreated = false;
+
+		// The box that lays out the name and the shared options button.
+		TSharedPtr<SHorizontalBox> ContentBox;
+
+		// The options button placed in this row, if any.
+		TSharedPtr<SWidget> OptionsButton;
 
 		// The enum viewer node with which this item is associated.
 		TSharedPtr<FEnumViewerNode> AssociatedNode;
+
+		// The property the owner's enum viewer is working on.
+		TSharedPtr<IPropertyHandle> PropertyHandle;
 		
 		// The event called when the enum line indicated by this widget is double-clicked.
 		FOnDoubleCliced OnDoubleClicked;
+
+		// The event called when the mouse enters or leaves this row.
+		FOnHoveredChanged OnHoveredChanged;
 	};
 }
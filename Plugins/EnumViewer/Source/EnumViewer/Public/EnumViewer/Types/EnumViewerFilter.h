@@ -21,5 +21,41 @@ namespace EnumViewer
 
 		// Checks if a unloaded enum is allowed by this filter.
 		virtual bool IsUnloadedEnumAllowed(const FEnumViewerInitializationOptions& InInitOptions, const FName InEnumPath) = 0;
+
+		// Checks which of the enums are allowed by this filter, setting one bit of the result for each enum.
+		// The enum viewer calls this for the enums that passed its own filters, a batch at a time.
+		// Override this to do work common to all the enums, such as resolving allow lists, once per batch.
+		virtual void AreEnumsAllowed(
+			const FEnumViewerInitializationOptions& InInitOptions,
+			TArrayView<const UEnum* const> InEnums,
+			TBitArray<>& OutAllowed
+		)
+		{
+			OutAllowed.Init(false, InEnums.Num());
+			for (int32 Index = 0; Index < InEnums.Num(); Index++)
+			{
+				OutAllowed[Index] = IsEnumAllowed(InInitOptions, InEnums[Index]);
+			}
+		}
+
+		// Checks which of the unloaded enums are allowed by this filter, setting one bit of the result for each enum path.
+		// Override this in the same way as AreEnumsAllowed.
+		virtual void AreUnloadedEnumsAllowed(
+			const FEnumViewerInitializationOptions& InInitOptions,
+			TArrayView<const FName> InEnumPaths,
+			TBitArray<>& OutAllowed
+		)
+		{
+			OutAllowed.Init(false, InEnumPaths.Num());
+			for (int32 Index = 0; Index < InEnumPaths.Num(); Index++)
+			{
+				OutAllowed[Index] = IsUnloadedEnumAllowed(InInitOptions, InEnumPaths[Index]);
+			}
+		}
+
+		// Returns whether the checks above can be called from worker threads at the same time.
+		// Only return true if they don't modify any state or touch anything other than the enum passed in, such as other UObjects.
+		// The enums passed to the checks are resolved on the game thread, so the enum viewer currently calls them there either way.
+		virtual bool IsThreadSafe() const { return false; }
 	};
 }
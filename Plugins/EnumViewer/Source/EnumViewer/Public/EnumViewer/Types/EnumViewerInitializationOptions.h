@@ -37,6 +37,19 @@ namespace EnumViewer
 		EnumName,
 	};
 
+	/**
+	 * How the search query is matched against the enum names.
+	 */
+	enum class EEnumViewerSearchMode : uint8
+	{
+		// List the enums whose names contain the query, sorted alphabetically.
+		Substring,
+
+		// List the enums whose names contain the characters of the query in order, best matches first.
+		// Queries with operators are still matched as substrings.
+		Fuzzy,
+	};
+
 	/**
 	 * Settings for the enum viewer set by the programmer before spawning an instance of the widget.  
 	 * This is used to modify the enum viewer's behavior in various ways, such as filtering in or out specific enums.
@@ -77,6 +90,13 @@ namespace EnumViewer
 		// Defines additional enums you want listed in the "Common Enums" section for the picker.
 		TArray<const UEnum*> ExtraPickerCommonEnums;
 
+		// Controls how the search query is matched.
+		EEnumViewerSearchMode SearchMode;
+
+		// The number of best matches ranked by score in fuzzy search mode.
+		// The remaining matches follow them in alphabetical order, so this should cover what fits on the screen.
+		int32 NumRankedSearchResults;
+
 	public:
 		// Constructor.
 		FEnumViewerInitializationOptions()
@@ -87,6 +107,8 @@ namespace EnumViewer
 			, NameTypeToDisplay(EEnumViewerNameTypeToDisplay::EnumName)
 			, bAllowViewOptions(true)
 			, bShowBackgroundBorder(true)
+			, SearchMode(EEnumViewerSearchMode::Substring)
+			, NumRankedSearchResults(50)
 		{
 		}
 	};